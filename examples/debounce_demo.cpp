@@ -0,0 +1,95 @@
+/**
+ * @file debounce_demo.cpp
+ * @brief How many messages reach the sinks with and without SeverityDebouncer
+ *
+ * A synthetic CPU signal sampled every 100 ms for ~17 minutes: it hovers
+ * around CpuPolicy::WARNING (75) with +-1.5 of noise, so the raw
+ * classification flips INFO <-> WARNING constantly, and it spikes above
+ * CpuPolicy::CRITICAL (90) for a few samples every 2 minutes.
+ *
+ * Each configuration is run over the same samples; the demo counts the
+ * admitted messages (what every sink would write) and FAILs if the first
+ * sample of any CRITICAL spike was not admitted at once.
+ *
+ * Build & run:
+ *   cmake -S ./examples -B build -DApp_Source_File=debounce_demo.cpp
+ *   cmake --build build && ./build/Demo
+ */
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "formatter/LogFormatter.hpp"
+#include "formatter/SeverityDebouncer.hpp"
+#include "formatter/policies/CpuPolicy.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t Samples = 10000;
+constexpr std::chrono::milliseconds Period{100};
+constexpr size_t SpikeEvery = 1200;         // 2 minutes
+constexpr size_t SpikeLength = 5;
+
+struct Run {
+    const char* name;
+    DebounceConfig config;
+};
+
+}
+
+int main() {
+    std::vector<float> values(Samples);
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> noise(-1.5f, 1.5f);
+    for (size_t i = 0; i < Samples; ++i) {
+        const bool spike = (i % SpikeEvery) >= SpikeEvery - SpikeLength;
+        values[i] = spike ? 95.0f : CpuPolicy::WARNING + noise(rng);
+    }
+
+    LogFormatter<CpuPolicy> formatter("Debounce");
+
+    std::vector<Run> runs(4);
+    runs[0] = {"off (every sample)", DebounceConfig{}};
+    runs[1] = {"hysteresis 2", DebounceConfig{2.0f, std::chrono::milliseconds(0), std::chrono::milliseconds(0)}};
+    runs[2] = {"hysteresis 2, dwell 1 s", DebounceConfig{2.0f, std::chrono::seconds(1), std::chrono::milliseconds(0)}};
+    runs[3] = {"... + heartbeat 60 s", DebounceConfig{2.0f, std::chrono::seconds(1), std::chrono::seconds(60)}};
+
+    std::cout << "Debounce demo: " << Samples << " samples every " << Period.count()
+              << " ms, noise around WARNING " << CpuPolicy::WARNING << ", spikes to CRITICAL\n\n";
+    std::cout << "  " << std::left << std::setw(28) << "configuration" << std::right
+              << std::setw(10) << "logged" << std::setw(12) << "reduction" << "\n";
+
+    bool ok = true;
+    for (const Run& run : runs) {
+        SeverityDebouncer debouncer(CpuPolicy::WARNING, CpuPolicy::CRITICAL, run.config);
+        const Clock::time_point start{};
+        size_t logged = 0;
+        SeverityLvl_enum previousRaw = SeverityLvl_enum::INFO;
+
+        for (size_t i = 0; i < Samples; ++i) {
+            LogMessage message = formatter.formatValueToLogMsg(values[i]);
+            const SeverityLvl_enum raw = message.GetSeverityLevel();
+            const bool admitted = !run.config.enabled() || debouncer.admit(message, start + Period * i);
+            logged += admitted;
+
+            const bool criticalOnset = raw == SeverityLvl_enum::CRITICAL && previousRaw != SeverityLvl_enum::CRITICAL;
+            if (criticalOnset && (!admitted || message.GetSeverityLevel() != SeverityLvl_enum::CRITICAL)) {
+                std::cout << "  FAIL: " << run.name << ": CRITICAL at sample " << i << " was held back\n";
+                ok = false;
+            }
+            previousRaw = raw;
+        }
+
+        std::cout << "  " << std::left << std::setw(28) << run.name << std::right
+                  << std::setw(10) << logged
+                  << std::setw(11) << std::fixed << std::setprecision(1)
+                  << (static_cast<double>(Samples) / static_cast<double>(logged)) << "x\n";
+    }
+
+    std::cout << "\n" << (ok ? "Every CRITICAL onset was logged at once" : "FAIL") << "\n";
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file filesink_benchmark.cpp
+ * @brief Lines/sec: legacy open-append-close FileSink vs persistent buffered FileSinkImpl
+ *
+ * "legacy" reproduces the old FileSinkImpl::write: construct an ofstream,
+ * open in append mode, write one line with std::endl, close - per message.
+ *
+ * Build & run:
+ *   cmake -S ./examples -B build -DApp_Source_File=filesink_benchmark.cpp
+ *   cmake --build build && ./build/Demo [lines] [directory]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "logger/LogMessage.hpp"
+#include "sinks/FileSinkImpl.hpp"
+
+// ============================================================
+// The previous implementation, kept here for comparison only
+// ============================================================
+class LegacyFileSink : public ILogSink {
+    private:
+        std::string FilePath;
+    public:
+        explicit LegacyFileSink(const std::string& path) : FilePath(path) {}
+
+        void write(const LogMessage &log_message) override {
+            std::ofstream outFile(FilePath.c_str(), std::ios::app);
+            if (outFile.is_open()) {
+                outFile << const_cast<LogMessage&>(log_message).ToString() << std::endl;
+                outFile.close();
+            }
+        }
+};
+
+// ============================================================
+// Helper: time 'lines' messages through a sink
+// ============================================================
+template <typename WriteFn>
+double linesPerSec(size_t lines, WriteFn writeAll) {
+    auto start = std::chrono::steady_clock::now();
+    writeAll();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(lines) / elapsed.count();
+}
+
+// ============================================================
+// Main
+// ============================================================
+int main(int argc, char* argv[]) {
+    const size_t lines = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 200000;
+    const std::string dir = (argc > 2) ? argv[2] : "/tmp";
+    const size_t batchSize = 64;
+
+    LogMessage msg("TelemetryMonitor", "CPU", "INFO", "2024-06-01 10:00:00", "CPUusage : 42.000000%");
+    std::vector<LogMessage> batch(batchSize, msg);
+
+    std::string legacyPath = dir + "/filesink_bench_legacy.log";
+    std::string bufferedPath = dir + "/filesink_bench_buffered.log";
+    std::string batchedPath = dir + "/filesink_bench_batched.log";
+    std::remove(legacyPath.c_str());
+    std::remove(bufferedPath.c_str());
+    std::remove(batchedPath.c_str());
+
+    double legacy = linesPerSec(lines, [&] {
+        LegacyFileSink sink(legacyPath);
+        for (size_t i = 0; i < lines; ++i) {
+            sink.write(msg);
+        }
+    });
+
+    double buffered = linesPerSec(lines, [&] {
+        FileSinkImpl sink(bufferedPath);
+        for (size_t i = 0; i < lines; ++i) {
+            sink.write(msg);
+        }
+        sink.flush();
+    });
+
+    double batched = linesPerSec(lines, [&] {
+        FileSinkImpl sink(batchedPath);
+        for (size_t i = 0; i < lines; i += batchSize) {
+            sink.writeBatch(batch.data(), std::min(batchSize, lines - i));
+        }
+        sink.flush();
+    });
+
+    std::cout << "FileSink benchmark: " << lines << " lines into " << dir << "\n\n";
+    std::cout << std::fixed << std::setprecision(0);
+    std::cout << std::left << std::setw(32) << "legacy (open/append/close)" << std::right << std::setw(14) << legacy << " lines/s\n";
+    std::cout << std::left << std::setw(32) << "buffered write()" << std::right << std::setw(14) << buffered << " lines/s"
+              << "  (" << std::setprecision(1) << buffered / legacy << "x)\n" << std::setprecision(0);
+    std::cout << std::left << std::setw(32) << "buffered writeBatch(64)" << std::right << std::setw(14) << batched << " lines/s"
+              << "  (" << std::setprecision(1) << batched / legacy << "x)\n";
+
+    std::remove(legacyPath.c_str());
+    std::remove(bufferedPath.c_str());
+    std::remove(batchedPath.c_str());
+    return 0;
+}
@@ -0,0 +1,208 @@
+/**
+ * @file linereader_benchmark.cpp
+ * @brief Reading lines from a socket: one byte per read() vs LineReader
+ *
+ * A writer thread serves an AF_UNIX stream socket and sends samples
+ * ("CPU: 42.17%\n"), one write() per line like a sensor would:
+ *   - paced   : 100k lines/s for the given duration
+ *   - flooded : as fast as possible (shows the headroom)
+ * The reader side is
+ *   - legacy     : the old SafeSocket::Read loop, read(fd, &ch, 1)
+ *   - LineReader : LineReader::readLine on the same kind of socket
+ *   - SafeSocket : SafeSocket::ReadLine, the path the socket source uses
+ * For each: lines received, read() calls, reader thread CPU time.
+ *
+ * Build & run:
+ *   cmake -S ./examples -B build -DApp_Source_File=linereader_benchmark.cpp
+ *   cmake --build build && ./build/Demo [seconds]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "raii/LineReader.hpp"
+#include "raii/SafeSocket.hpp"
+
+namespace {
+
+constexpr size_t LinesPerSecond = 100000;
+
+struct ReadStats {
+    size_t lines = 0;
+    size_t bytes = 0;
+    uint64_t reads = 0;         // 0 = not observable (SafeSocket)
+    double cpuMs = 0.0;
+    double wallMs = 0.0;
+};
+
+double threadCpuMs() {
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<double>(ts.tv_sec) * 1e3 + static_cast<double>(ts.tv_nsec) / 1e6;
+}
+
+sockaddr_un addressOf(const std::string& path) {
+    sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+    return addr;
+}
+
+int listenOn(const std::string& path) {
+    unlink(path.c_str());
+    const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un addr = addressOf(path);
+    if (fd < 0 || bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || listen(fd, 1) != 0) {
+        std::cerr << "Error: cannot listen on " << path << std::endl;
+        std::exit(1);
+    }
+    return fd;
+}
+
+int connectTo(const std::string& path) {
+    const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un addr = addressOf(path);
+    if (fd < 0 || connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        std::cerr << "Error: cannot connect to " << path << std::endl;
+        std::exit(1);
+    }
+    return fd;
+}
+
+// One write() per line; paced to LinesPerSecond in 1 ms steps, or flat out
+void serve(int listenFd, size_t lines, bool paced) {
+    const int fd = accept(listenFd, nullptr, nullptr);
+    if (fd < 0) {
+        return;
+    }
+    char line[32];
+    const auto start = std::chrono::steady_clock::now();
+    size_t sent = 0;
+    while (sent < lines) {
+        size_t due = lines;
+        if (paced) {
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            due = std::min(lines, static_cast<size_t>(
+                std::chrono::duration<double>(elapsed).count() * LinesPerSecond) + 1);
+        }
+        for (; sent < due; ++sent) {
+            const int length = std::snprintf(line, sizeof(line), "CPU: %zu.%02zu%%\n", sent % 100, sent % 97);
+            if (write(fd, line, static_cast<size_t>(length)) != length) {
+                close(fd);
+                return;
+            }
+        }
+        if (paced) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    close(fd);
+}
+
+template <typename ReadLoop>
+ReadStats run(const std::string& path, size_t lines, bool paced, ReadLoop&& readLoop) {
+    const int listenFd = listenOn(path);
+    std::thread writer(serve, listenFd, lines, paced);
+
+    ReadStats stats;
+    const auto wallStart = std::chrono::steady_clock::now();
+    const double cpuStart = threadCpuMs();
+    readLoop(stats);
+    stats.cpuMs = threadCpuMs() - cpuStart;
+    stats.wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wallStart).count();
+
+    writer.join();
+    close(listenFd);
+    unlink(path.c_str());
+    return stats;
+}
+
+void legacyLoop(const std::string& path, ReadStats& stats) {
+    const int fd = connectTo(path);
+    std::string line;
+    char ch;
+    for (;;) {
+        ++stats.reads;
+        const ssize_t received = read(fd, &ch, 1);
+        if (received != 1) {
+            break;
+        }
+        if (ch == '\n') {
+            stats.bytes += line.size();
+            ++stats.lines;
+            line.clear();
+            continue;
+        }
+        line += ch;
+    }
+    close(fd);
+}
+
+void lineReaderLoop(const std::string& path, ReadStats& stats) {
+    const int fd = connectTo(path);
+    LineReader reader;
+    std::string_view line;
+    while (reader.readLine(fd, line)) {
+        stats.bytes += line.size();
+        ++stats.lines;
+    }
+    stats.reads = reader.readCalls();
+    close(fd);
+}
+
+void safeSocketLoop(std::string path, ReadStats& stats) {
+    SafeSocket socket(path);
+    std::string_view line;
+    while (socket.ReadLine(line)) {
+        stats.bytes += line.size();
+        ++stats.lines;
+    }
+}
+
+void report(const char* name, const ReadStats& stats) {
+    std::cout << "  " << std::left << std::setw(12) << name << std::right
+              << std::setw(9) << stats.lines << " lines"
+              << std::setw(10);
+    if (stats.reads > 0) {
+        std::cout << stats.reads << " reads" << std::setw(7) << std::fixed << std::setprecision(2)
+                  << (static_cast<double>(stats.reads) / static_cast<double>(stats.lines)) << "/line";
+    } else {
+        std::cout << "-" << " reads" << std::setw(12) << " ";
+    }
+    std::cout << std::setw(9) << std::fixed << std::setprecision(1) << stats.cpuMs << " ms CPU"
+              << std::setw(8) << std::setprecision(0)
+              << (static_cast<double>(stats.lines) / stats.wallMs) << "k lines/s\n";
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    const double seconds = (argc > 1) ? std::atof(argv[1]) : 2.0;
+    const size_t lines = static_cast<size_t>(seconds * LinesPerSecond);
+    if (lines == 0) {
+        std::cerr << "Error: duration must be positive" << std::endl;
+        return 1;
+    }
+    const std::string path = "/tmp/linereader_benchmark.sock";
+
+    for (bool paced : {true, false}) {
+        std::cout << (paced ? "Paced, " : "Flooded, ") << lines << " lines"
+                  << (paced ? " at 100k lines/s" : ", one write() each, no pacing") << "\n";
+        report("legacy", run(path, lines, paced, [&](ReadStats& s) { legacyLoop(path, s); }));
+        report("LineReader", run(path, lines, paced, [&](ReadStats& s) { lineReaderLoop(path, s); }));
+        report("SafeSocket", run(path, lines, paced, [&](ReadStats& s) { safeSocketLoop(path, s); }));
+        std::cout << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,244 @@
+/**
+ * @file listener_benchmark.cpp
+ * @brief Many producers on one listening socket: throughput and fairness
+ *
+ * A ListenerTelemetrySourceImpl listens on one AF_UNIX path; its epoll
+ * descriptor is registered with a Reactor, and the handler reads up to
+ * 256 lines per wake-up (deferring the rest), as TelemetryApp does.
+ *   - throughput : 10, 100 and 400 agent threads each send lines as fast
+ *                  as they can; reported are lines/s and consumer CPU per line
+ *   - fairness   : one agent floods while 10 paced agents send a line
+ *                  carrying its send time every 2 ms; reported is the paced
+ *                  lines' latency, with and without the flood
+ *
+ * Build & run:
+ *   cmake -S ./examples -B build -DApp_Source_File=listener_benchmark.cpp
+ *   cmake --build build && ./build/Demo [lines per agent]
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "sources/ListenerTelemetrySourceImpl.hpp"
+#include "utils/Reactor.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+std::string ListenPath = "/tmp/listener_benchmark.sock";
+
+constexpr size_t MaxLinesPerWake = 256;
+
+double threadCpuMs() {
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<double>(ts.tv_sec) * 1e3 + static_cast<double>(ts.tv_nsec) / 1e6;
+}
+
+int64_t nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+}
+
+int connectAgent() {
+    const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, ListenPath.c_str(), sizeof(addr.sun_path) - 1);
+    // The backlog may be full while the consumer accepts: retry briefly
+    for (int attempt = 0; attempt < 200; ++attempt) {
+        if (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0) {
+            return fd;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    close(fd);
+    return -1;
+}
+
+bool sendAll(int fd, const char* data, size_t length) {
+    while (length > 0) {
+        const ssize_t written = send(fd, data, length, MSG_NOSIGNAL);
+        if (written <= 0) {
+            return false;
+        }
+        data += written;
+        length -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+// Lines in batches of 64 per write(), like an agent with a small output buffer
+void floodAgent(size_t lines, const std::atomic<bool>* stop) {
+    const int fd = connectAgent();
+    if (fd < 0) {
+        return;
+    }
+    char batch[64 * 16];
+    size_t length = 0;
+    for (size_t i = 0; i < lines && !(stop && *stop); ++i) {
+        length += static_cast<size_t>(std::snprintf(batch + length, 16, "CPU: %zu%%\n", i % 100));
+        if (length > sizeof(batch) - 16) {
+            if (!sendAll(fd, batch, length)) break;
+            length = 0;
+        }
+    }
+    sendAll(fd, batch, length);
+    close(fd);
+}
+
+void pacedAgent(size_t lines) {
+    const int fd = connectAgent();
+    if (fd < 0) {
+        return;
+    }
+    for (size_t i = 0; i < lines; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        const std::string line = "T: " + std::to_string(nowNs()) + "\n";
+        if (!sendAll(fd, line.data(), line.size())) break;
+    }
+    close(fd);
+}
+
+// Reads the listener from a Reactor until onLine(line) returns false
+template <typename OnLine>
+double consume(ListenerTelemetrySourceImpl& listener, OnLine&& onLine) {
+    Reactor reactor;
+    bool done = false;
+    std::string line;
+    std::function<void()> drain = [&] {
+        size_t lines = 0;
+        while (!done && lines < MaxLinesPerWake && listener.readSource(line) && !line.empty()) {
+            done = !onLine(line);
+            ++lines;
+        }
+        if (done) {
+            reactor.stop();
+        } else if (lines == MaxLinesPerWake) {
+            reactor.defer(drain);
+        }
+    };
+    reactor.watch(listener.sourceFd(), EPOLLIN, [&](uint32_t) { drain(); });
+    // Agents that fail to connect never send: give up after a while
+    reactor.addTimer(std::chrono::seconds(30), [&](uint32_t) { reactor.stop(); });
+
+    const double cpuStart = threadCpuMs();
+    reactor.run();
+    const double cpuMs = threadCpuMs() - cpuStart;
+    if (!done) {
+        std::cerr << "Error: not every line arrived" << std::endl;
+    }
+    return cpuMs;
+}
+
+void throughput(size_t agents, size_t linesPerAgent) {
+    ListenerTelemetrySourceImpl listener(ListenPath, agents);
+    if (!listener.openSource()) {
+        std::cerr << "Error: cannot listen on " << ListenPath << std::endl;
+        std::exit(1);
+    }
+    const size_t expected = agents * linesPerAgent;
+    const auto wallStart = Clock::now();
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < agents; ++i) {
+        threads.emplace_back(floodAgent, linesPerAgent, nullptr);
+    }
+    size_t received = 0;
+    const double cpuMs = consume(listener, [&](const std::string&) { return ++received < expected; });
+    const double wallS = std::chrono::duration<double>(Clock::now() - wallStart).count();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    std::cout << "  " << std::setw(4) << agents << " agents   " << std::fixed << std::setprecision(2)
+              << std::setw(6) << static_cast<double>(expected) / wallS / 1e6 << " M lines/s   CPU "
+              << std::setw(4) << std::setprecision(0) << cpuMs * 1e6 / static_cast<double>(expected)
+              << " ns/line   accepted " << listener.acceptedCount() << "\n";
+}
+
+void fairness(bool flood, size_t pacedLines) {
+    constexpr size_t PacedAgents = 10;
+    ListenerTelemetrySourceImpl listener(ListenPath);
+    if (!listener.openSource()) {
+        std::cerr << "Error: cannot listen on " << ListenPath << std::endl;
+        std::exit(1);
+    }
+    std::atomic<bool> stopFlood{false};
+    std::thread flooder;
+    if (flood) {
+        flooder = std::thread(floodAgent, SIZE_MAX, &stopFlood);
+    }
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < PacedAgents; ++i) {
+        threads.emplace_back(pacedAgent, pacedLines);
+    }
+
+    std::vector<double> latencies;
+    latencies.reserve(PacedAgents * pacedLines);
+    size_t floodLines = 0;
+    const size_t expected = PacedAgents * pacedLines;
+    consume(listener, [&](const std::string& line) {
+        if (line[0] != 'T') {
+            ++floodLines;
+            return true;
+        }
+        latencies.push_back(static_cast<double>(nowNs() - std::strtoll(line.c_str() + 3, nullptr, 10)) / 1000.0);
+        return latencies.size() < expected;
+    });
+    // Closing unblocks a flooder stuck on a full socket buffer
+    stopFlood = true;
+    listener.closeSource();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (flooder.joinable()) {
+        flooder.join();
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    auto at = [&](double q) { return latencies[static_cast<size_t>(q * static_cast<double>(latencies.size() - 1))]; };
+    std::cout << "  " << std::left << std::setw(13) << (flood ? "with flood" : "alone") << std::right
+              << std::fixed << std::setprecision(0)
+              << "p50 " << std::setw(6) << at(0.50) << " us   p99 " << std::setw(6) << at(0.99)
+              << " us   max " << std::setw(6) << latencies.back() << " us";
+    if (flood) {
+        std::cout << "   (flood: " << floodLines << " lines meanwhile)";
+    }
+    std::cout << "\n";
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    const size_t linesPerAgent = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 10000;
+    if (linesPerAgent == 0) {
+        std::cerr << "Error: line count must be positive" << std::endl;
+        return 1;
+    }
+
+    std::cout << "Listener benchmark, " << linesPerAgent << " lines per agent\n\n";
+    for (size_t agents : {10, 100, 400}) {
+        throughput(agents, linesPerAgent);
+    }
+
+    std::cout << "\n10 agents, one line every 2 ms each:\n";
+    fairness(false, 500);
+    fairness(true, 500);
+
+    unlink(ListenPath.c_str());
+    return 0;
+}
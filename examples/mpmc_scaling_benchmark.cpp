@@ -0,0 +1,127 @@
+/**
+ * @file mpmc_scaling_benchmark.cpp
+ * @brief Producer scaling: RingBuffer<LogMessage> vs MpmcRingBuffer<LogMessage>
+ *
+ * 1..32 producer threads push LogMessages while ONE consumer drains them,
+ * the same shape as many threads calling LogManager::log() with a single
+ * flushing thread. Three variants are measured:
+ *   - "mx+mutex" : old LogManager::log path (LogManager::mx + RingBuffer mutex)
+ *   - "mutex"    : RingBuffer alone
+ *   - "mpmc"     : MpmcRingBuffer (per-slot sequence numbers, no locks)
+ *
+ * Build & run:
+ *   cmake -S ./examples -B build -DApp_Source_File=mpmc_scaling_benchmark.cpp
+ *   cmake --build build && ./build/Demo [total_items]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "utils/RingBuffer.hpp"
+#include "utils/MpmcRingBuffer.hpp"
+#include "logger/LogMessage.hpp"
+
+// ============================================================
+// Helper: N producers / 1 consumer, return messages/sec
+// ============================================================
+template <typename PushFn, typename PopFn>
+double runScaling(size_t producers, size_t totalItems, PushFn push, PopFn pop) {
+    const size_t perProducer = totalItems / producers;
+    const size_t expected = perProducer * producers;
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::thread consumer([&pop, expected] {
+        size_t received = 0;
+        while (received < expected) {
+            if (pop()) {
+                ++received;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::vector<std::thread> threads;
+    for (size_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&push, perProducer] {
+            for (size_t i = 0; i < perProducer; ++i) {
+                LogMessage msg("TelemetryMonitor", "CPU", "INFO",
+                               "2024-06-01 10:00:00", "CPUusage : 42.000000%");
+                while (!push(msg)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+    consumer.join();
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(expected) / elapsed.count();
+}
+
+// ============================================================
+// Main
+// ============================================================
+int main(int argc, char* argv[]) {
+    const size_t totalItems = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    const size_t capacity = 1024;
+
+    std::cout << "Producer scaling benchmark: " << totalItems
+              << " LogMessages per run, 1 consumer, capacity " << capacity << "\n\n";
+    std::cout << std::setw(10) << "producers"
+              << std::setw(16) << "mx+mutex msg/s"
+              << std::setw(16) << "mutex msg/s"
+              << std::setw(16) << "mpmc msg/s"
+              << std::setw(10) << "speedup\n";
+    std::cout << std::string(67, '-') << "\n";
+
+    for (size_t producers : {1, 2, 4, 8, 16, 32}) {
+        double lockedOps;
+        {
+            std::mutex outerMx;
+            RingBuffer<LogMessage> buffer(capacity);
+            lockedOps = runScaling(producers, totalItems,
+                [&](const LogMessage& m) {
+                    std::lock_guard<std::mutex> lock(outerMx);
+                    return buffer.try_push(m);
+                },
+                [&] { return buffer.try_pop().has_value(); });
+        }
+
+        double mutexOps;
+        {
+            RingBuffer<LogMessage> buffer(capacity);
+            mutexOps = runScaling(producers, totalItems,
+                [&](const LogMessage& m) { return buffer.try_push(m); },
+                [&] { return buffer.try_pop().has_value(); });
+        }
+
+        double mpmcOps;
+        {
+            MpmcRingBuffer<LogMessage> buffer(capacity);
+            mpmcOps = runScaling(producers, totalItems,
+                [&](const LogMessage& m) { return buffer.try_push(m); },
+                [&] { return buffer.try_pop().has_value(); });
+        }
+
+        std::cout << std::setw(10) << producers
+                  << std::fixed << std::setprecision(0)
+                  << std::setw(16) << lockedOps
+                  << std::setw(16) << mutexOps
+                  << std::setw(16) << mpmcOps
+                  << std::setw(9) << std::setprecision(2) << (mpmcOps / lockedOps) << "x\n";
+    }
+
+    return 0;
+}
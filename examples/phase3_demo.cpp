@@ -1,6 +1,12 @@
+#include <cmath>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 // Policies
@@ -23,6 +29,10 @@
 #include "sinks/LogSinkFactory.hpp"
 #include "sinks/SinkConfig.hpp"
 
+// Buffers
+#include "utils/MpmcRingBuffer.hpp"
+#include "utils/RingBuffer.hpp"
+
 // ============================================
 // Test Utilities
 // ============================================
@@ -495,6 +505,150 @@ void testFullIntegration() {
     std::cout << "  - integration_test.log\n";
 }
 
+// ============================================
+// Test 13: Overwrite Overflow Keeps CRITICAL
+// ============================================
+// Records what reaches the sink, in order
+class RecordingSink : public ILogSink {
+public:
+    void write(const LogMessage &log_message) override {
+        std::lock_guard<std::mutex> lock(mx);
+        written.push_back({log_message.GetSeverityLevel(), log_message.GetValue().value_or(-1.0f)});
+    }
+
+    std::mutex mx;
+    std::vector<std::pair<SeverityLvl_enum, float>> written;
+};
+
+void testOverwriteKeepsCritical() {
+    TestUtils::printHeader("Test 13: Overwrite Overflow Keeps CRITICAL");
+
+    TestUtils::printSubHeader("Conditional Pop");
+    {
+        RingBuffer<int> ring(4);
+        MpmcRingBuffer<int> mpmc(4);
+        for (int value : {1, 2}) {
+            ring.try_push(value);
+            mpmc.try_push(value);
+        }
+        auto notOne = [](int value) { return value != 1; };
+        TestUtils::printResult("RingBuffer::try_pop_if() leaves a rejected head in place",
+                               !ring.try_pop_if(notOne).has_value() && ring.size() == 2 && ring.try_pop() == 1);
+        TestUtils::printResult("MpmcRingBuffer::try_pop_if() leaves a rejected head in place",
+                               !mpmc.try_pop_if(notOne).has_value() && mpmc.size() == 2 && mpmc.try_pop() == 1);
+    }
+
+    // A full buffer whose oldest entries are CRITICAL: overwriting must drop
+    // the incoming INFO messages, not the CRITICAL ones, and keep their order
+    LogFormatter<CpuPolicy> formatter("Overwrite");
+    for (LogBufferType_enum bufferType : {LogBufferType_enum::MUTEX, LogBufferType_enum::MPMC}) {
+        const char* name = (bufferType == LogBufferType_enum::MUTEX) ? "MUTEX" : "MPMC";
+        TestUtils::printSubHeader(std::string("DROP_OLDEST, ") + name + " buffer of 8");
+
+        RecordingSink* sink = new RecordingSink();
+        LogManager manager(8, 2, bufferType);
+        LogOverflowConfig overflow;
+        overflow.policy = LogOverflowPolicy_enum::DROP_OLDEST;
+        manager.setOverflowPolicy(overflow);
+        manager.addSink(sink);
+
+        // Values carry a sequence number (CRITICAL from 91.000, INFO from 0.000)
+        constexpr int Rounds = 50;
+        char value[16];
+        int sequence = 0;
+        int criticalLogged = 0;
+        for (int round = 0; round < Rounds; ++round) {
+            for (int i = 0; i < 72; ++i, ++sequence) {
+                const bool critical = i < 8;
+                std::snprintf(value, sizeof(value), "%.3f", (critical ? 91.0 : 0.0) + sequence * 0.001);
+                manager.log(*formatter.formatDataToLogMsg(value));
+                criticalLogged += critical;
+            }
+        }
+        manager.flush();
+
+        int criticalWritten = 0;
+        bool inOrder = true;
+        long last = -1;
+        for (const auto& entry : sink->written) {
+            const bool critical = entry.first == SeverityLvl_enum::CRITICAL;
+            const long written = std::lround((entry.second - (critical ? 91.0f : 0.0f)) * 1000.0f);
+            inOrder = inOrder && written > last;
+            last = written;
+            criticalWritten += critical;
+        }
+        std::cout << "  Written: " << sink->written.size() << ", INFO dropped: "
+                  << manager.getDroppedCount(SeverityLvl_enum::INFO) << "\n";
+        TestUtils::printResult("No CRITICAL dropped", manager.getDroppedCount(SeverityLvl_enum::CRITICAL) == 0);
+        TestUtils::printResult("Every CRITICAL written before flush() returned", criticalWritten == criticalLogged);
+        TestUtils::printResult("Messages written in the order logged", inOrder);
+    }
+}
+
+// ============================================
+// Test 14: File Sink Flushes Without New Writes
+// ============================================
+size_t linesIn(const std::string& path) {
+    std::ifstream file(path);
+    size_t lines = 0;
+    for (std::string line; std::getline(file, line);) {
+        ++lines;
+    }
+    return lines;
+}
+
+void testFileSinkTimedFlush() {
+    TestUtils::printHeader("Test 14: File Sink Flushes Without New Writes");
+
+    std::string intervalPath = "timed_flush_test.log";
+    std::string criticalPath = "critical_flush_test.log";
+    std::remove(intervalPath.c_str());
+    std::remove(criticalPath.c_str());
+
+    LogFormatter<CpuPolicy> formatter("TimedFlush");
+    LogManager manager(16, 2);
+    manager.addSink(new FileSinkImpl(intervalPath, FileSinkImpl::DefaultFlushBytes,
+                                     std::chrono::milliseconds(100)));
+    manager.addSink(new FileSinkImpl(criticalPath, FileSinkImpl::DefaultFlushBytes,
+                                     std::chrono::milliseconds(60000)));
+
+    // One line, then nothing: only the timer can write it out
+    manager.log(*formatter.formatDataToLogMsg("10.0"));
+    std::this_thread::sleep_for(std::chrono::milliseconds(400));
+    TestUtils::printResult("Buffered line written after the interval with no further writes",
+                           linesIn(intervalPath) == 1);
+    TestUtils::printResult("INFO line still buffered under a 60 s interval", linesIn(criticalPath) == 0);
+
+    manager.log(*formatter.formatDataToLogMsg("95.0"));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    TestUtils::printResult("CRITICAL line written at once", linesIn(criticalPath) == 2);
+}
+
+// ============================================
+// Test 15: Five-String LogMessage
+// ============================================
+void testLegacyLogMessage() {
+    TestUtils::printHeader("Test 15: Five-String LogMessage");
+
+    LogMessage named("Agent-7", "Disk", "INFO", "2024-05-06 07:08:09", "up");
+    TestUtils::printResult("Names come back through the intern table",
+                           named.GetAppName() == "Agent-7" && named.GetContext() == "Disk");
+
+    LogMessage original("App", "Ctx", "Warn", "2024-05-06 07:08:09", "text");
+    LogMessage copy(original);
+    LogMessage moved(std::move(copy));
+    TestUtils::printResult("Copy and move keep names and label",
+                           moved.ToString() == "[2024-05-06 07:08:09] <Warn> (App - Ctx) : text");
+    moved.SetSeverityLevel(SeverityLvl_enum::CRITICAL);
+    TestUtils::printResult("SetSeverityLevel replaces the label",
+                           moved.ToString() == "[2024-05-06 07:08:09] <CRITICAL> (App - Ctx) : text");
+
+    const uint64_t cutBefore = LogMessage::truncatedCount();
+    LogMessage big("App", "Ctx", "INFO", "2024-05-06 07:08:09", std::string(70000, 'x'));
+    TestUtils::printResult("Oversized text is cut at 65535 bytes and counted",
+                           big.GetMessage().size() == 65535 && LogMessage::truncatedCount() == cutBefore + 1);
+}
+
 // ============================================
 // Main
 // ============================================
@@ -520,6 +674,9 @@ int main() {
         testLogManagerOperations();
         testPolicyBehaviorComparison();
         testFullIntegration();
+        testOverwriteKeepsCritical();
+        testFileSinkTimedFlush();
+        testLegacyLogMessage();
 
         // Summary
         TestUtils::printSummary();
@@ -530,6 +687,8 @@ int main() {
         std::cout << "  - builder_test.log\n";
         std::cout << "  - manager_test.log\n";
         std::cout << "  - integration_test.log\n";
+        std::cout << "  - timed_flush_test.log\n";
+        std::cout << "  - critical_flush_test.log\n";
 
         std::cout << "\n╔═══════════════════════════════════════════════════════════════╗\n";
         std::cout << "║                    DEMO COMPLETED                             ║\n";
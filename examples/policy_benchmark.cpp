@@ -0,0 +1,114 @@
+/**
+ * @file policy_benchmark.cpp
+ * @brief Templated LogFormatter<Policy> vs runtime PolicyTable
+ *
+ * Same values, same thresholds (CpuPolicy), three stages:
+ *   - classify : severity only (constexpr thresholds vs one table row load)
+ *   - value    : full lazy LogMessage from a float
+ *   - parse    : raw line -> SampleParser -> LogMessage
+ * The table holds 64 rows and the runtime path walks them round-robin,
+ * as TelemetryApp does with many sources; the templated path has no row.
+ * A Timestamp::Ticker runs so the clock read does not dominate.
+ *
+ * Build & run:
+ *   cmake -S ./examples -B build -DApp_Source_File=policy_benchmark.cpp
+ *   cmake --build build && ./build/Demo [iterations]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "formatter/LogFormatter.hpp"
+#include "formatter/LogFormatterHelper.hpp"
+#include "formatter/PolicyTable.hpp"
+#include "formatter/policies/CpuPolicy.hpp"
+#include "utils/Timestamp.hpp"
+
+namespace {
+
+constexpr size_t Sources = 64;
+
+// Keeps the optimizer from dropping the work
+volatile size_t sink = 0;
+
+template <typename F>
+double nsPerOp(size_t iterations, F&& f) {
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        f(i);
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(iterations);
+}
+
+void report(const char* stage, double templated, double runtime) {
+    std::cout << "  " << std::left << std::setw(10) << stage << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << templated << " ns"
+              << std::setw(10) << runtime << " ns"
+              << std::setw(9) << std::setprecision(2) << (runtime / templated) << "x\n";
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    const size_t iterations = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+
+    std::vector<float> values(4096);
+    std::vector<std::string> lines(values.size());
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> dist(0.0f, 100.0f);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = dist(rng);
+        lines[i] = "CPU: " + std::to_string(values[i]) + "%";
+    }
+    const size_t mask = values.size() - 1;
+
+    Timestamp::Ticker ticker;
+    LogFormatter<CpuPolicy> templated("Bench");
+    PolicyTable table("Bench");
+    for (size_t i = 0; i < Sources; ++i) {
+        table.add<CpuPolicy>();
+    }
+
+    std::cout << "Policy benchmark, " << iterations << " iterations, " << Sources << " table rows\n\n";
+    std::cout << "  " << std::left << std::setw(10) << "stage" << std::right
+              << std::setw(13) << "templated" << std::setw(13) << "runtime" << std::setw(9) << "ratio" << "\n";
+
+    report("classify",
+        nsPerOp(iterations, [&](size_t i) {
+            sink = sink + static_cast<size_t>(LogFormatterHelper::GetSeverityLevel(
+                values[i & mask], CpuPolicy::CRITICAL, CpuPolicy::WARNING));
+        }),
+        nsPerOp(iterations, [&](size_t i) {
+            sink = sink + static_cast<size_t>(table.classify(
+                static_cast<PolicyTable::SourceId>(i % Sources), values[i & mask]));
+        }));
+
+    report("value",
+        nsPerOp(iterations, [&](size_t i) {
+            LogMessage message = templated.formatValueToLogMsg(values[i & mask]);
+            sink = sink + static_cast<size_t>(message.GetSeverityLevel());
+        }),
+        nsPerOp(iterations, [&](size_t i) {
+            LogMessage message = table.formatValueToLogMsg(
+                static_cast<PolicyTable::SourceId>(i % Sources), values[i & mask]);
+            sink = sink + static_cast<size_t>(message.GetSeverityLevel());
+        }));
+
+    report("parse",
+        nsPerOp(iterations, [&](size_t i) {
+            auto message = templated.formatDataToLogMsg(lines[i & mask]);
+            sink = sink + static_cast<size_t>(message->GetSeverityLevel());
+        }),
+        nsPerOp(iterations, [&](size_t i) {
+            auto message = table.formatDataToLogMsg(
+                static_cast<PolicyTable::SourceId>(i % Sources), lines[i & mask]);
+            sink = sink + static_cast<size_t>(message->GetSeverityLevel());
+        }));
+
+    return 0;
+}
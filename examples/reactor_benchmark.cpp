@@ -0,0 +1,194 @@
+/**
+ * @file reactor_benchmark.cpp
+ * @brief Sample-to-handler latency and idle CPU: sleep polling vs Reactor
+ *
+ * A writer thread sends lines carrying their send time (steady_clock ns)
+ * over a socketpair, at random 1-5 ms intervals. Two consumers:
+ *   - polling : the old TelemetryApp::mainLoop cadence - check the source,
+ *               then sleep 2 ms five times
+ *   - Reactor : the socket registered with Reactor::watch; the handler
+ *               runs when the line arrives
+ * Both read with LineReader, so only the wake-up strategy differs.
+ * Reported: latency percentiles, consumer CPU time, and CPU used while
+ * idle (one second with no data and a 1 s timer).
+ *
+ * Build & run:
+ *   cmake -S ./examples -B build -DApp_Source_File=reactor_benchmark.cpp
+ *   cmake --build build && ./build/Demo [lines]
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "raii/LineReader.hpp"
+#include "utils/Reactor.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double threadCpuMs() {
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<double>(ts.tv_sec) * 1e3 + static_cast<double>(ts.tv_nsec) / 1e6;
+}
+
+int64_t nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+}
+
+void writeLines(int fd, size_t lines) {
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> gapUs(1000, 5000);
+    for (size_t i = 0; i < lines; ++i) {
+        std::this_thread::sleep_for(std::chrono::microseconds(gapUs(rng)));
+        const std::string line = std::to_string(nowNs()) + "\n";
+        if (write(fd, line.data(), line.size()) != static_cast<ssize_t>(line.size())) {
+            break;
+        }
+    }
+    shutdown(fd, SHUT_WR);
+}
+
+// Latency of one received line, in microseconds
+void record(std::string_view line, std::vector<double>& latencies) {
+    const int64_t sent = std::strtoll(std::string(line).c_str(), nullptr, 10);
+    latencies.push_back(static_cast<double>(nowNs() - sent) / 1000.0);
+}
+
+void report(const char* name, std::vector<double>& latencies, double cpuMs) {
+    std::sort(latencies.begin(), latencies.end());
+    auto at = [&](double q) { return latencies[static_cast<size_t>(q * static_cast<double>(latencies.size() - 1))]; };
+    std::cout << "  " << std::left << std::setw(9) << name << std::right << std::fixed << std::setprecision(0)
+              << "p50 " << std::setw(7) << at(0.50) << " us"
+              << "   p99 " << std::setw(7) << at(0.99) << " us"
+              << "   max " << std::setw(7) << latencies.back() << " us"
+              << "   CPU " << std::setw(5) << std::setprecision(1) << cpuMs << " ms\n";
+}
+
+void pollingConsumer(int fd, std::vector<double>& latencies, const std::atomic<bool>& done) {
+    LineReader reader;
+    std::string_view line;
+    while (!done) {
+        while (reader.readLine(fd, line)) {
+            record(line, latencies);
+        }
+        for (int i = 0; i < 5; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    }
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    const size_t lines = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 1000;
+    if (lines == 0) {
+        std::cerr << "Error: line count must be positive" << std::endl;
+        return 1;
+    }
+    std::cout << "Reactor benchmark, " << lines << " lines at random 1-5 ms intervals\n\n";
+
+    // Polling consumer (the reader is non-blocking, as the loop must not block)
+    {
+        int fds[2];
+        socketpair(AF_UNIX, SOCK_STREAM, 0, fds);
+        fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL) | O_NONBLOCK);
+        std::vector<double> latencies;
+        latencies.reserve(lines);
+        std::atomic<bool> done{false};
+
+        std::thread writer(writeLines, fds[1], lines);
+        const double cpuStart = threadCpuMs();
+        std::thread stopper([&] { writer.join(); std::this_thread::sleep_for(std::chrono::milliseconds(20)); done = true; });
+        pollingConsumer(fds[0], latencies, done);
+        const double cpuMs = threadCpuMs() - cpuStart;
+        stopper.join();
+        report("polling", latencies, cpuMs);
+        close(fds[0]);
+        close(fds[1]);
+    }
+
+    // Reactor consumer
+    {
+        int fds[2];
+        socketpair(AF_UNIX, SOCK_STREAM, 0, fds);
+        std::vector<double> latencies;
+        latencies.reserve(lines);
+
+        Reactor reactor;
+        LineReader reader;
+        reactor.watch(fds[0], EPOLLIN | EPOLLRDHUP, [&](uint32_t events) {
+            std::string_view line;
+            while (reader.readLine(fds[0], line)) {
+                record(line, latencies);
+            }
+            if (events & (EPOLLHUP | EPOLLRDHUP)) {
+                reactor.stop();
+            }
+        });
+
+        std::thread writer(writeLines, fds[1], lines);
+        const double cpuStart = threadCpuMs();
+        reactor.run();
+        const double cpuMs = threadCpuMs() - cpuStart;
+        writer.join();
+        report("Reactor", latencies, cpuMs);
+        close(fds[0]);
+        close(fds[1]);
+    }
+
+    // Idle: no data for one second
+    std::cout << "\nIdle for 1 s:\n";
+    {
+        std::atomic<bool> done{false};
+        LineReader reader;
+        int fds[2];
+        socketpair(AF_UNIX, SOCK_STREAM, 0, fds);
+        fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL) | O_NONBLOCK);
+        std::thread stopper([&] { std::this_thread::sleep_for(std::chrono::seconds(1)); done = true; });
+        const double cpuStart = threadCpuMs();
+        const auto wallStart = Clock::now();
+        size_t wakeups = 0;
+        while (!done) {
+            std::string_view line;
+            reader.readLine(fds[0], line);
+            ++wakeups;
+            for (int i = 0; i < 5; ++i) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+        }
+        const double cpuMs = threadCpuMs() - cpuStart;
+        stopper.join();
+        std::cout << "  polling  " << std::setw(6) << wakeups << " wake-ups in "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - wallStart).count()
+                  << " ms, CPU " << std::setprecision(2) << cpuMs << " ms\n";
+        close(fds[0]);
+        close(fds[1]);
+    }
+    {
+        Reactor reactor;
+        size_t wakeups = 0;
+        reactor.addTimer(std::chrono::seconds(1), [&](uint32_t) { ++wakeups; reactor.stop(); });
+        const double cpuStart = threadCpuMs();
+        const auto wallStart = Clock::now();
+        reactor.run();
+        const double cpuMs = threadCpuMs() - cpuStart;
+        std::cout << "  Reactor  " << std::setw(6) << wakeups << " wake-ups in "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - wallStart).count()
+                  << " ms, CPU " << std::setprecision(2) << cpuMs << " ms\n";
+    }
+    return 0;
+}
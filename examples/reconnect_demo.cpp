@@ -0,0 +1,263 @@
+/**
+ * @file reconnect_demo.cpp
+ * @brief Socket sources with read deadlines and backoff reconnect, next to a healthy one
+ *
+ * Two AF_UNIX producers feed one TelemetryApp:
+ *   - healthy : a TEMP line every 100 ms for the whole run
+ *   - flaky   : 10 CPU lines, then stalls with the connection open
+ *               (readTimeoutMs 500 closes it), then dies and its socket
+ *               disappears for 1.5 s (reconnects fail and back off), then
+ *               comes back for 10 more lines and exits
+ * The app's messages go to the console and to a log file. Afterwards the
+ * demo counts the healthy source's lines in the file, and FAILs if any
+ * went missing while the other producer misbehaved.
+ *
+ * Then a second, short run with one socket source and no read deadline,
+ * so no other timer is pending: its producer sends 5 lines and hangs up,
+ * then waits for the app to reconnect and sends 5 more. The retry timer
+ * is added from the hang-up handler, outside the scheduler; the demo
+ * FAILs if the reconnect never comes.
+ *
+ * Last, a file source on a FIFO whose writer sends 10 lines 100 ms
+ * apart: between lines nothing is queued, which must not count as the
+ * source closing. FAILs unless all 10 lines are logged.
+ *
+ * Build & run:
+ *   cmake -S ./examples -B build -DApp_Source_File=reconnect_demo.cpp
+ *   cmake --build build && ./build/Demo
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "app/TelemetryApp.hpp"
+
+namespace {
+
+const std::string HealthyPath = "/tmp/reconnect_demo_healthy.sock";
+const std::string FlakyPath = "/tmp/reconnect_demo_flaky.sock";
+const std::string ConfigPath = "/tmp/reconnect_demo.json";
+const std::string LogPath = "/tmp/reconnect_demo.log";
+const std::string HangupPath = "/tmp/reconnect_demo_hangup.sock";
+const std::string HangupConfigPath = "/tmp/reconnect_demo_hangup.json";
+const std::string HangupLogPath = "/tmp/reconnect_demo_hangup.log";
+const std::string FifoPath = "/tmp/reconnect_demo.fifo";
+const std::string FifoConfigPath = "/tmp/reconnect_demo_fifo.json";
+const std::string FifoLogPath = "/tmp/reconnect_demo_fifo.log";
+
+constexpr int HealthyLines = 50;
+constexpr std::chrono::milliseconds Period{100};
+
+int listenOn(const std::string& path) {
+    unlink(path.c_str());
+    const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+    if (fd < 0 || bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || listen(fd, 4) != 0) {
+        std::cerr << "Error: cannot listen on " << path << std::endl;
+        std::exit(1);
+    }
+    return fd;
+}
+
+void sendLines(int fd, const char* format, int count) {
+    char line[32];
+    for (int i = 0; i < count; ++i) {
+        const int length = std::snprintf(line, sizeof(line), format, 40 + i % 20);
+        if (write(fd, line, static_cast<size_t>(length)) != length) {
+            return;
+        }
+        std::this_thread::sleep_for(Period);
+    }
+}
+
+void healthy(int listenFd) {
+    const int fd = accept(listenFd, nullptr, nullptr);
+    sendLines(fd, "TEMP: %d.0\n", HealthyLines);
+    close(fd);
+}
+
+void flaky(int listenFd) {
+    int fd = accept(listenFd, nullptr, nullptr);
+    sendLines(fd, "CPU: %d.0%%\n", 10);
+    std::cout << "[flaky] stalling" << std::endl;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1200));
+
+    std::cout << "[flaky] gone" << std::endl;
+    close(fd);
+    close(listenFd);
+    unlink(FlakyPath.c_str());
+    std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+
+    std::cout << "[flaky] back" << std::endl;
+    listenFd = listenOn(FlakyPath);
+    fd = accept(listenFd, nullptr, nullptr);
+    sendLines(fd, "CPU: %d.0%%\n", 10);
+    close(fd);
+    close(listenFd);
+    unlink(FlakyPath.c_str());
+}
+
+// Keeps listening across the hang-up; false if the app never came back
+bool hangup(int listenFd, std::chrono::milliseconds& gap) {
+    int fd = accept(listenFd, nullptr, nullptr);
+    sendLines(fd, "CPU: %d.0%%\n", 5);
+    std::cout << "[hangup] closing" << std::endl;
+    close(fd);
+    const auto closed = std::chrono::steady_clock::now();
+
+    pollfd ready{listenFd, POLLIN, 0};
+    if (poll(&ready, 1, 3000) != 1) {
+        return false;
+    }
+    fd = accept(listenFd, nullptr, nullptr);
+    gap = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - closed);
+    std::cout << "[hangup] reconnected after " << gap.count() << " ms" << std::endl;
+    sendLines(fd, "CPU: %d.0%%\n", 5);
+    close(fd);
+    return true;
+}
+
+bool hangupReconnects() {
+    std::ofstream(HangupConfigPath) << R"({
+  "application": {"name": "Hangup"},
+  "sources": [
+    {"type": "socket", "path": ")" << HangupPath << R"(", "telemetryType": "CPU",
+     "rateMs": 100, "reconnect": {"minMs": 100, "maxMs": 800}}
+  ],
+  "sinks": [{"type": "file", "path": ")" << HangupLogPath << R"("}]
+})";
+    std::remove(HangupLogPath.c_str());
+
+    const int listenFd = listenOn(HangupPath);
+    bool reconnected = false;
+    std::chrono::milliseconds gap{0};
+    std::thread server([&] { reconnected = hangup(listenFd, gap); });
+    {
+        telemetry::TelemetryApp app(HangupConfigPath);
+        std::thread stopper([&app] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2500));
+            app.stop();
+        });
+        app.start();
+        stopper.join();
+    }
+    server.join();
+    close(listenFd);
+    unlink(HangupPath.c_str());
+
+    std::ifstream log(HangupLogPath);
+    int received = 0;
+    for (std::string line; std::getline(log, line);) {
+        received += line.find("CPU") != std::string::npos;
+    }
+    std::cout << "\nHang-up source: " << (reconnected ? "reconnected" : "never reconnected")
+              << ", " << received << " of 10 lines logged\n";
+    // First retry after minMs (100) with jitter: well under a second
+    return reconnected && gap < std::chrono::seconds(1) && received == 10;
+}
+
+bool fifoStaysOpen() {
+    std::ofstream(FifoConfigPath) << R"({
+  "application": {"name": "Fifo"},
+  "sources": [
+    {"type": "file", "path": ")" << FifoPath << R"(", "telemetryType": "CPU", "rateMs": 100}
+  ],
+  "sinks": [{"type": "file", "path": ")" << FifoLogPath << R"("}]
+})";
+    std::remove(FifoLogPath.c_str());
+    unlink(FifoPath.c_str());
+    if (mkfifo(FifoPath.c_str(), 0600) != 0) {
+        std::cerr << "Error: cannot create " << FifoPath << std::endl;
+        return false;
+    }
+
+    std::thread writer([] {
+        const int fd = open(FifoPath.c_str(), O_WRONLY);
+        sendLines(fd, "CPU: %d.0%%\n", 10);
+        close(fd);
+    });
+    {
+        telemetry::TelemetryApp app(FifoConfigPath);
+        std::thread stopper([&app] {
+            std::this_thread::sleep_for(Period * 10 + std::chrono::milliseconds(700));
+            app.stop();
+        });
+        app.start();
+        stopper.join();
+    }
+    writer.join();
+    unlink(FifoPath.c_str());
+
+    std::ifstream log(FifoLogPath);
+    int received = 0;
+    for (std::string line; std::getline(log, line);) {
+        received += line.find("CPU") != std::string::npos;
+    }
+    std::cout << "\nFIFO source: " << received << " of 10 lines logged\n";
+    return received == 10;
+}
+
+}
+
+int main() {
+    std::ofstream(ConfigPath) << R"({
+  "application": {"name": "Reconnect"},
+  "sources": [
+    {"type": "socket", "path": ")" << HealthyPath << R"(", "telemetryType": "TEMP",
+     "rateMs": 100, "warning": 70, "critical": 85, "unit": "C"},
+    {"type": "socket", "path": ")" << FlakyPath << R"(", "telemetryType": "CPU",
+     "rateMs": 100, "readTimeoutMs": 500, "reconnect": {"minMs": 100, "maxMs": 800}}
+  ],
+  "sinks": [{"type": "console"}, {"type": "file", "path": ")" << LogPath << R"("}]
+})";
+    std::remove(LogPath.c_str());
+
+    const int healthyFd = listenOn(HealthyPath);
+    const int flakyFd = listenOn(FlakyPath);
+    std::thread healthyServer(healthy, healthyFd);
+    std::thread flakyServer(flaky, flakyFd);
+
+    {
+        telemetry::TelemetryApp app(ConfigPath);
+        std::thread stopper([&app] {
+            std::this_thread::sleep_for(Period * HealthyLines + std::chrono::milliseconds(500));
+            app.stop();
+        });
+        app.start();
+        stopper.join();
+    }
+    healthyServer.join();
+    flakyServer.join();
+    close(healthyFd);
+    unlink(HealthyPath.c_str());
+
+    std::ifstream log(LogPath);
+    int received = 0;
+    for (std::string line; std::getline(log, line);) {
+        received += line.find("TEMP") != std::string::npos;
+    }
+    std::cout << "\nHealthy source: " << received << " of " << HealthyLines << " lines logged\n";
+    const bool ok = received == HealthyLines;
+    std::cout << (ok ? "No healthy samples lost while the other producer misbehaved" : "FAIL") << "\n";
+
+    const bool reconnectOk = hangupReconnects();
+    std::cout << (reconnectOk ? "Hang-up without a read deadline reconnected" : "FAIL") << "\n";
+
+    const bool fifoOk = fifoStaysOpen();
+    std::cout << (fifoOk ? "FIFO source kept reading between lines" : "FAIL") << "\n";
+    return ok && reconnectOk && fifoOk ? 0 : 1;
+}
@@ -0,0 +1,103 @@
+/**
+ * @file ringbuffer_benchmark.cpp
+ * @brief RingBuffer (mutex) vs SpscRingBuffer (lock-free) throughput
+ *
+ * One producer thread pushes N items while one consumer thread pops them,
+ * spinning on full/empty exactly like LogManager's producer/worker pair.
+ *
+ * Build & run:
+ *   cmake -S ./examples -B build -DApp_Source_File=ringbuffer_benchmark.cpp
+ *   cmake --build build && ./build/Demo [items]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "utils/RingBuffer.hpp"
+#include "utils/SpscRingBuffer.hpp"
+#include "logger/LogMessage.hpp"
+
+// ============================================================
+// Helper: run one producer/consumer pair, return ops/sec
+// ============================================================
+template <typename Buffer, typename MakeItem>
+double runPair(Buffer& buffer, size_t items, MakeItem makeItem) {
+    auto start = std::chrono::steady_clock::now();
+
+    std::thread consumer([&buffer, items] {
+        size_t received = 0;
+        while (received < items) {
+            if (buffer.try_pop().has_value()) {
+                ++received;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    for (size_t i = 0; i < items; ++i) {
+        auto item = makeItem(i);
+        // try_push only consumes the item when it succeeds, so retrying a moved item is safe
+        while (!buffer.try_push(std::move(item))) {
+            std::this_thread::yield();
+        }
+    }
+
+    consumer.join();
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(items) / elapsed.count();
+}
+
+void printRow(const std::string& name, double mutexOps, double spscOps) {
+    std::cout << std::left << std::setw(14) << name
+              << std::right << std::setw(16) << std::fixed << std::setprecision(0) << mutexOps
+              << std::setw(16) << spscOps
+              << std::setw(10) << std::setprecision(2) << (spscOps / mutexOps) << "x\n";
+}
+
+// ============================================================
+// Main
+// ============================================================
+int main(int argc, char* argv[]) {
+    const size_t items = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 5000000;
+    const size_t capacity = 1024;
+
+    std::cout << "RingBuffer benchmark: 1 producer / 1 consumer, "
+              << items << " items, capacity " << capacity << "\n\n";
+    std::cout << std::left << std::setw(14) << "payload"
+              << std::right << std::setw(16) << "mutex ops/s"
+              << std::setw(16) << "spsc ops/s"
+              << std::setw(11) << "speedup\n";
+    std::cout << std::string(57, '-') << "\n";
+
+    // Small payload: measures pure synchronization cost
+    {
+        auto makeItem = [](size_t i) { return i; };
+        RingBuffer<size_t> mutexBuffer(capacity);
+        SpscRingBuffer<size_t> spscBuffer(capacity);
+        double mutexOps = runPair(mutexBuffer, items, makeItem);
+        double spscOps = runPair(spscBuffer, items, makeItem);
+        printRow("size_t", mutexOps, spscOps);
+    }
+
+    // Real payload: what LogManager actually queues
+    {
+        const size_t logItems = items / 5;
+        auto makeItem = [](size_t) {
+            return LogMessage("TelemetryMonitor", "CPU", "INFO",
+                              "2024-06-01 10:00:00", "CPUusage : 42.000000%");
+        };
+        RingBuffer<LogMessage> mutexBuffer(capacity);
+        SpscRingBuffer<LogMessage> spscBuffer(capacity);
+        double mutexOps = runPair(mutexBuffer, logItems, makeItem);
+        double spscOps = runPair(spscBuffer, logItems, makeItem);
+        printRow("LogMessage", mutexOps, spscOps);
+    }
+
+    return 0;
+}
@@ -0,0 +1,140 @@
+/**
+ * @file severity_benchmark.cpp
+ * @brief Classifying 10M samples: one at a time vs SeverityClassifier batches
+ *
+ *   - GetSeverity       : the per-sample helper that returns a std::string
+ *   - GetSeverityLevel  : the per-sample helper that returns the enum
+ *   - scalar/SSE2/AVX2  : SeverityClassifier::classifyWith, levels + counts
+ *   - counts only       : classify() with no output array
+ * Every kernel's output is checked against GetSeverityLevel first. Values
+ * are uniform in [0, 100) so the three classes mix and branches mispredict
+ * as they would on real data. Best of 5 passes is reported.
+ *
+ * Build & run:
+ *   cmake -S ./examples -B build -DApp_Source_File=severity_benchmark.cpp
+ *   cmake --build build && ./build/Demo [samples]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "formatter/LogFormatterHelper.hpp"
+#include "formatter/SeverityClassifier.hpp"
+#include "formatter/policies/CpuPolicy.hpp"
+
+namespace {
+
+constexpr int Passes = 5;
+
+// Keeps the optimizer from dropping the work
+volatile size_t sink = 0;
+
+const char* kernelName(SimdKernel_enum kernel) {
+    switch (kernel) {
+        case SimdKernel_enum::SCALAR: return "scalar";
+        case SimdKernel_enum::SSE2:   return "SSE2";
+        case SimdKernel_enum::AVX2:   return "AVX2";
+    }
+    return "?";
+}
+
+template <typename F>
+double bestNsPerSample(size_t samples, F&& f) {
+    double best = 0.0;
+    for (int pass = 0; pass < Passes; ++pass) {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        const double ns = std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(samples);
+        best = (pass == 0) ? ns : std::min(best, ns);
+    }
+    return best;
+}
+
+void report(const std::string& name, double ns, double baseline) {
+    std::cout << "  " << std::left << std::setw(28) << name << std::right << std::fixed
+              << std::setw(8) << std::setprecision(3) << ns << " ns/sample"
+              << std::setw(10) << std::setprecision(0) << (1000.0 / ns) << " M/s"
+              << std::setw(9) << std::setprecision(1) << (baseline / ns) << "x\n";
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    const size_t samples = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    if (samples == 0) {
+        std::cerr << "Error: sample count must be positive" << std::endl;
+        return 1;
+    }
+
+    std::vector<float> values(samples);
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> dist(0.0f, 100.0f);
+    for (float& value : values) {
+        value = dist(rng);
+    }
+    std::vector<SeverityLvl_enum> expected(samples);
+    std::vector<SeverityLvl_enum> levels(samples);
+
+    std::cout << "Severity benchmark, " << samples << " samples, CpuPolicy thresholds, best of "
+              << Passes << "\n";
+    std::cout << "Runtime kernel: " << kernelName(SeverityClassifier::kernel()) << "\n\n";
+
+    const double stringNs = bestNsPerSample(samples, [&] {
+        size_t total = 0;
+        for (float value : values) {
+            total += LogFormatterHelper::GetSeverity(value, CpuPolicy::CRITICAL, CpuPolicy::WARNING).size();
+        }
+        sink = sink + total;
+    });
+    report("GetSeverity (string)", stringNs, stringNs);
+
+    report("GetSeverityLevel", bestNsPerSample(samples, [&] {
+        for (size_t i = 0; i < samples; ++i) {
+            expected[i] = LogFormatterHelper::GetSeverityLevel(values[i], CpuPolicy::CRITICAL, CpuPolicy::WARNING);
+        }
+        sink = sink + static_cast<size_t>(expected[samples / 2]);
+    }), stringNs);
+
+    SeverityCounts reference;
+    for (SeverityLvl_enum level : expected) {
+        reference.critical += (level == SeverityLvl_enum::CRITICAL);
+        reference.warning += (level == SeverityLvl_enum::WARNING);
+        reference.info += (level == SeverityLvl_enum::INFO);
+    }
+
+    bool ok = true;
+    for (SimdKernel_enum kernel : {SimdKernel_enum::SCALAR, SimdKernel_enum::SSE2, SimdKernel_enum::AVX2}) {
+        if (!SeverityClassifier::supported(kernel)) {
+            std::cout << "  " << std::left << std::setw(28) << kernelName(kernel) << "not supported by this CPU\n";
+            continue;
+        }
+        const SeverityCounts counts = SeverityClassifier::classifyWith(
+            kernel, values.data(), samples, CpuPolicy::CRITICAL, CpuPolicy::WARNING, levels.data());
+        if (levels != expected || counts.critical != reference.critical
+            || counts.warning != reference.warning || counts.info != reference.info) {
+            std::cout << "  FAIL: " << kernelName(kernel) << " disagrees with GetSeverityLevel\n";
+            ok = false;
+            continue;
+        }
+        report(std::string("classifyWith ") + kernelName(kernel), bestNsPerSample(samples, [&] {
+            const SeverityCounts pass = SeverityClassifier::classifyWith(
+                kernel, values.data(), samples, CpuPolicy::CRITICAL, CpuPolicy::WARNING, levels.data());
+            sink = sink + pass.critical;
+        }), stringNs);
+    }
+
+    report("classify, counts only", bestNsPerSample(samples, [&] {
+        const SeverityCounts pass = SeverityClassifier::classify<CpuPolicy>(values.data(), samples);
+        sink = sink + pass.critical;
+    }), stringNs);
+
+    std::cout << "\nCounts: critical " << reference.critical << ", warning " << reference.warning
+              << ", info " << reference.info << "\n";
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,168 @@
+/**
+ * @file threadpool_benchmark.cpp
+ * @brief Task throughput: single-queue ThreadPool vs work-stealing ThreadPool
+ *
+ * "legacy" reproduces the previous ThreadPool: one std::queue behind one
+ * mutex and condition variable shared by every submit and every pickup.
+ * Two workloads are measured at 1, 4 and 16 workers:
+ *   - "external" : one outside thread submits every task (LogManager's
+ *                  flushing thread handing batches to the sinks)
+ *   - "fan-out"  : tasks submit follow-up tasks from inside the pool
+ *                  (a tree of depth 'depth', branching factor 4)
+ *
+ * Build & run:
+ *   cmake -S ./examples -B build -DApp_Source_File=threadpool_benchmark.cpp
+ *   cmake --build build && ./build/Demo [tasks]
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "utils/ThreadPool.hpp"
+
+// ============================================================
+// The previous implementation, kept here for comparison only
+// ============================================================
+class LegacyThreadPool {
+    private:
+        std::vector<std::thread> workers;
+        std::mutex mx;
+        std::condition_variable cv;
+        std::atomic<bool> stop;
+        std::queue<std::function<void()>> tasks;
+
+    public:
+        explicit LegacyThreadPool(size_t threads) : stop(false) {
+            for (size_t i = 0; i < threads; ++i) {
+                workers.emplace_back([this] {
+                    std::unique_lock<std::mutex> lock(mx, std::defer_lock);
+                    std::function<void()> task;
+                    while (true) {
+                        lock.lock();
+                        cv.wait(lock, [this] { return stop.load() || !tasks.empty(); });
+                        if (stop.load() && tasks.empty()) {return;}
+                        task = std::move(tasks.front());
+                        tasks.pop();
+                        lock.unlock();
+                        task();
+                    }
+                });
+            }
+        }
+
+        void submit(std::function<void()> task) {
+            {
+                std::lock_guard<std::mutex> lock(mx);
+                tasks.emplace(std::move(task));
+            }
+            cv.notify_one();
+        }
+
+        ~LegacyThreadPool() {
+            stop = true;
+            cv.notify_all();
+            for (std::thread& worker : workers) {
+                worker.join();
+            }
+        }
+};
+
+// ============================================================
+// Workloads
+// ============================================================
+static void waitFor(const std::atomic<size_t>& done, size_t expected) {
+    while (done.load(std::memory_order_acquire) < expected) {
+        std::this_thread::yield();
+    }
+}
+
+template <typename Pool>
+double externalTasksPerSec(size_t workers, size_t tasks) {
+    Pool pool(workers);
+    std::atomic<size_t> done{0};
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < tasks; ++i) {
+        pool.submit([&done] { done.fetch_add(1, std::memory_order_release); });
+    }
+    waitFor(done, tasks);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(tasks) / elapsed.count();
+}
+
+template <typename Pool>
+void spawnTree(Pool& pool, std::atomic<size_t>& done, size_t depth) {
+    done.fetch_add(1, std::memory_order_release);
+    if (depth == 0) {
+        return;
+    }
+    for (int child = 0; child < 4; ++child) {
+        pool.submit([&pool, &done, depth] { spawnTree(pool, done, depth - 1); });
+    }
+}
+
+template <typename Pool>
+double fanOutTasksPerSec(size_t workers, size_t depth) {
+    size_t tasks = 0;
+    for (size_t level = 0, width = 1; level <= depth; ++level, width *= 4) {
+        tasks += width;
+    }
+
+    Pool pool(workers);
+    std::atomic<size_t> done{0};
+
+    auto start = std::chrono::steady_clock::now();
+    pool.submit([&pool, &done, depth] { spawnTree(pool, done, depth); });
+    waitFor(done, tasks);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(tasks) / elapsed.count();
+}
+
+void printRow(const std::string& name, size_t workers, double legacy, double stealing) {
+    std::cout << std::left << std::setw(10) << name
+              << std::right << std::setw(8) << workers
+              << std::fixed << std::setprecision(0)
+              << std::setw(16) << legacy
+              << std::setw(16) << stealing
+              << std::setw(9) << std::setprecision(2) << (stealing / legacy) << "x\n";
+}
+
+// ============================================================
+// Main
+// ============================================================
+int main(int argc, char* argv[]) {
+    const size_t tasks = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    const size_t depth = 9;     // 1 + 4 + ... + 4^9 = 349525 tasks
+
+    std::cout << "ThreadPool benchmark: " << tasks << " external tasks, fan-out depth "
+              << depth << " (" << std::thread::hardware_concurrency() << " hardware threads)\n\n";
+    std::cout << std::left << std::setw(10) << "workload"
+              << std::right << std::setw(8) << "workers"
+              << std::setw(16) << "legacy tasks/s"
+              << std::setw(16) << "ws tasks/s"
+              << std::setw(10) << "speedup\n";
+    std::cout << std::string(59, '-') << "\n";
+
+    for (size_t workers : {1, 4, 16}) {
+        printRow("external", workers,
+                 externalTasksPerSec<LegacyThreadPool>(workers, tasks),
+                 externalTasksPerSec<ThreadPool>(workers, tasks));
+    }
+    for (size_t workers : {1, 4, 16}) {
+        printRow("fan-out", workers,
+                 fanOutTasksPerSec<LegacyThreadPool>(workers, depth),
+                 fanOutTasksPerSec<ThreadPool>(workers, depth));
+    }
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+/**
+ * @file timestamp_benchmark.cpp
+ * @brief Cost of stamping one sample: legacy put_time vs Timestamp
+ *
+ * "legacy" reproduces the previous LogFormatterHelper::GetCurrentTimeStamp:
+ * system_clock::now, localtime (global tz lock), std::put_time into an
+ * ostringstream - one second resolution. It is compared with:
+ *   - Timestamp::format  : cached per-thread second prefix + to_chars
+ *                          milliseconds, into a stack buffer
+ *   - nowNs / coarseNowNs: reading the clock alone, real vs Ticker-fed
+ *
+ * Build & run:
+ *   cmake -S ./examples -B build -DApp_Source_File=timestamp_benchmark.cpp
+ *   cmake --build build && ./build/Demo [iterations]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "utils/Timestamp.hpp"
+
+namespace {
+
+std::string legacyTimeStamp() {
+    auto now = std::chrono::system_clock::now();
+    auto time = std::chrono::system_clock::to_time_t(now);
+
+    std::ostringstream oss;
+    oss << std::put_time(std::localtime(&time), "%Y-%m-%d %H:%M:%S");
+
+    return oss.str();
+}
+
+// Keeps the optimizer from dropping the work
+volatile size_t sink = 0;
+
+template <typename F>
+double nsPerOp(size_t iterations, F&& f) {
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        f();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(iterations);
+}
+
+void report(const char* name, double ns) {
+    std::cout << "  " << std::left << std::setw(34) << name
+              << std::right << std::setw(10) << std::fixed << std::setprecision(1) << ns << " ns/op\n";
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    const size_t iterations = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+
+    std::cout << "Timestamp benchmark, " << iterations << " iterations\n\n";
+
+    std::cout << "Formatted timestamp:\n";
+    report("legacy (localtime + put_time)", nsPerOp(iterations, [] {
+        sink = sink + legacyTimeStamp().size();
+    }));
+    report("Timestamp::format (ms, buffer)", nsPerOp(iterations, [] {
+        char buffer[Timestamp::MaxLength];
+        sink = sink + Timestamp::format(Timestamp::nowNs(), buffer);
+    }));
+    report("Timestamp::format (us, string)", nsPerOp(iterations, [] {
+        sink = sink + Timestamp::format(Timestamp::nowNs(), Timestamp::Precision::Micros).size();
+    }));
+
+    std::cout << "\nClock read only:\n";
+    report("Timestamp::nowNs", nsPerOp(iterations, [] {
+        sink = sink + static_cast<size_t>(Timestamp::nowNs());
+    }));
+    {
+        Timestamp::Ticker ticker;
+        report("Timestamp::coarseNowNs (Ticker)", nsPerOp(iterations, [] {
+            sink = sink + static_cast<size_t>(Timestamp::coarseNowNs());
+        }));
+        report("format(coarseNowNs)", nsPerOp(iterations, [] {
+            char buffer[Timestamp::MaxLength];
+            sink = sink + Timestamp::format(Timestamp::coarseNowNs(), buffer);
+        }));
+    }
+
+    std::cout << "\nSample: " << Timestamp::format(Timestamp::nowNs(), Timestamp::Precision::Micros) << "\n";
+    return 0;
+}
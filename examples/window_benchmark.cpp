@@ -0,0 +1,165 @@
+/**
+ * @file window_benchmark.cpp
+ * @brief WindowAggregator: cost per sample, percentile accuracy, message volume
+ *
+ *   - cost     : add() over 10M samples (one window), and summary();
+ *                again with thresholds (per-severity counts, checked
+ *                against classifying one sample at a time)
+ *   - accuracy : P-square p50/p95/p99 against exact percentiles (sorted
+ *                copy) for a normal and a long-tailed distribution
+ *   - volume   : a GPU-like source read every 300 ms for one simulated
+ *                hour, messages per hour with and without windows
+ *
+ * Build & run:
+ *   cmake -S ./examples -B build -DApp_Source_File=window_benchmark.cpp
+ *   cmake --build build && ./build/Demo [samples]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "formatter/WindowAggregator.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Keeps the optimizer from dropping the work
+volatile float sink = 0.0f;
+
+float exactQuantile(std::vector<float> sorted, double quantile) {
+    std::sort(sorted.begin(), sorted.end());
+    return sorted[static_cast<size_t>(quantile * static_cast<double>(sorted.size() - 1) + 0.5)];
+}
+
+void accuracy(const char* name, const std::vector<float>& values) {
+    WindowAggregator window(std::chrono::hours(1));
+    const Clock::time_point start{};
+    for (float value : values) {
+        window.add(value, start);
+    }
+    const WindowSummary summary = window.summary();
+
+    const std::pair<const char*, std::pair<float, double>> rows[] = {
+        {"p50", {summary.p50, 0.50}}, {"p95", {summary.p95, 0.95}}, {"p99", {summary.p99, 0.99}}
+    };
+    std::cout << "  " << name << "\n";
+    for (const auto& row : rows) {
+        const float exact = exactQuantile(values, row.second.second);
+        const double error = std::fabs(row.second.first - exact) / std::fabs(exact) * 100.0;
+        std::cout << "    " << row.first << std::fixed << std::setprecision(3)
+                  << "  sketch " << std::setw(9) << row.second.first
+                  << "  exact " << std::setw(9) << exact
+                  << "  error " << std::setw(6) << std::setprecision(2) << error << " %\n";
+    }
+}
+
+size_t messagesPerHour(std::chrono::milliseconds period, std::chrono::milliseconds windowLength) {
+    const Clock::time_point start{};
+    const Clock::time_point end = start + std::chrono::hours(1);
+    if (windowLength.count() == 0) {
+        return static_cast<size_t>((end - start) / period);
+    }
+    WindowAggregator window(windowLength);
+    size_t messages = 0;
+    for (Clock::time_point now = start; now < end; now += period) {
+        window.add(50.0f, now);
+        if (window.due(now)) {
+            sink = window.summary().max;
+            window.reset();
+            ++messages;
+        }
+    }
+    return messages + (window.count() > 0 ? 1 : 0);
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    const size_t samples = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    if (samples == 0) {
+        std::cerr << "Error: sample count must be positive" << std::endl;
+        return 1;
+    }
+
+    std::mt19937 rng(11);
+    std::normal_distribution<float> normal(60.0f, 10.0f);
+    std::lognormal_distribution<float> tailed(3.0f, 0.6f);
+    std::vector<float> values(samples);
+    for (float& value : values) {
+        value = normal(rng);
+    }
+
+    std::cout << "Window benchmark, " << samples << " samples\n\n";
+
+    {
+        WindowAggregator window(std::chrono::hours(1));
+        const Clock::time_point start{};
+        const auto begin = Clock::now();
+        for (float value : values) {
+            window.add(value, start);
+        }
+        const auto added = Clock::now();
+        const WindowSummary summary = window.summary();
+        const auto summarized = Clock::now();
+        sink = summary.p99;
+
+        std::cout << "Cost:\n" << std::fixed << std::setprecision(2)
+                  << "  add()      " << std::chrono::duration<double, std::nano>(added - begin).count() / static_cast<double>(samples)
+                  << " ns/sample\n"
+                  << "  summary()  " << std::chrono::duration<double, std::nano>(summarized - added).count()
+                  << " ns\n"
+                  << "  state      " << sizeof(WindowAggregator) << " bytes, no allocation\n";
+    }
+    {
+        constexpr float Warning = 70.0f;
+        constexpr float Critical = 80.0f;
+        WindowAggregator window(std::chrono::hours(1), Warning, Critical);
+        const Clock::time_point start{};
+        const auto begin = Clock::now();
+        for (float value : values) {
+            window.add(value, start);
+        }
+        const auto added = Clock::now();
+        const WindowSummary summary = window.summary();
+
+        uint64_t warning = 0;
+        uint64_t critical = 0;
+        for (float value : values) {
+            critical += value > Critical;
+            warning += value <= Critical && value > Warning;
+        }
+        std::cout << "  add() with severity counts " << std::fixed << std::setprecision(2)
+                  << std::chrono::duration<double, std::nano>(added - begin).count() / static_cast<double>(samples)
+                  << " ns/sample (warning " << summary.warning << ", critical " << summary.critical << ")\n\n";
+        if (summary.warning != warning || summary.critical != critical) {
+            std::cerr << "Error: severity counts differ from per-sample classification ("
+                      << warning << ", " << critical << " expected)" << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << "Accuracy (P-square, " << samples << " samples in one window):\n";
+    accuracy("normal(60, 10)", values);
+    for (float& value : values) {
+        value = tailed(rng);
+    }
+    accuracy("lognormal(3, 0.6)", values);
+
+    std::cout << "\nVolume, source read every 300 ms for one hour:\n";
+    const size_t perSample = messagesPerHour(std::chrono::milliseconds(300), std::chrono::milliseconds(0));
+    for (int seconds : {0, 3, 10, 30}) {
+        const size_t messages = messagesPerHour(std::chrono::milliseconds(300), std::chrono::seconds(seconds));
+        std::cout << "  " << std::left << std::setw(14)
+                  << (seconds == 0 ? std::string("every sample") : "window " + std::to_string(seconds) + " s")
+                  << std::right << std::setw(8) << messages << " messages"
+                  << std::setw(9) << std::setprecision(1)
+                  << (static_cast<double>(perSample) / static_cast<double>(messages)) << "x\n";
+    }
+    return 0;
+}
@@ -10,13 +10,13 @@
 #include <QThread>
 #include <QMutex>
 #include <QTimer>
-#include <QFuture>
 #include <memory>
 #include <atomic>
 #include <map>
 
 #include "ConfigDialog.hpp"
 #include "sources/ITelemetrySource.hpp"
+#include "utils/ThreadPool.hpp"
 
 // Forward declarations
 class LogManager;
@@ -129,13 +129,17 @@ private:
     };
     std::map<QString, SourceEntry> m_sources;
     
-    std::map<QString, QFuture<bool>> m_pendingConnections;
+    // Runs openSource() off the GUI thread; declared before the
+    // Completions so it outlives them
+    ThreadPool m_connectPool;
+    std::map<QString, Completion> m_pendingConnections;
     
     std::unique_ptr<LogFormatter<CpuPolicy>> m_cpuFormatter;
     std::unique_ptr<LogFormatter<GpuPolicy>> m_gpuFormatter;
     std::unique_ptr<LogFormatter<RamPolicy>> m_ramFormatter;
     
     static constexpr int MAX_RECONNECT_ATTEMPTS = 5;
+    static constexpr size_t CONNECT_POOL_SIZE = 2;
     static constexpr int RECONNECT_INTERVAL_MS = 5000;
 };
 
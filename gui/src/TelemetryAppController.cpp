@@ -14,7 +14,7 @@
 #include <QElapsedTimer>
 #include <QTextStream>
 #include <QRegularExpression>
-#include <QtConcurrent/QtConcurrent>
+#include <QMetaObject>
 
 #include "sources/FileTelemetrySourceImpl.hpp"
 #include "sources/SocketTelemetrySourceImpl.hpp"
@@ -24,6 +24,7 @@
 #endif
 
 #include "formatter/LogFormatter.hpp"
+#include "formatter/SampleParser.hpp"
 #include "formatter/policies/CpuPolicy.hpp"
 #include "formatter/policies/GpuPolicy.hpp"
 #include "formatter/policies/RamPolicy.hpp"
@@ -42,6 +43,7 @@ TelemetryAppController::TelemetryAppController(QObject *parent)
     , m_isRunning(false)
     , m_isStopping(false)
     , m_totalRamMB(0.0)
+    , m_connectPool(CONNECT_POOL_SIZE)
 {
     m_config.appName = "TelemetryApp";
     m_config.bufferSize = 100;
@@ -75,10 +77,8 @@ TelemetryAppController::~TelemetryAppController()
 {
     stop();
     
-    for (auto &[name, future] : m_pendingConnections) {
-        if (future.isRunning()) {
-            future.waitForFinished();
-        }
+    for (auto &[name, pending] : m_pendingConnections) {
+        pending.wait();
     }
 }
 
@@ -293,6 +293,10 @@ void TelemetryAppController::createSources()
 
 void TelemetryAppController::destroySources()
 {
+    // openSource() may still be running on a source we are about to destroy
+    for (auto &[name, pending] : m_pendingConnections) {
+        pending.wait();
+    }
     m_pendingConnections.clear();
     m_sources.clear();
 }
@@ -321,25 +325,18 @@ void TelemetryAppController::connectSourceAsync(const QString &sourceName)
     
     locker.unlock();
     
-    // Run connection in background thread
-    QFuture<bool> future = QtConcurrent::run([sourcePtr]() -> bool {
-        return sourcePtr->openSource();
-    });
-    
-    m_pendingConnections[sourceName] = future;
-    
-    // Use QFutureWatcher to get notified when done
-    auto *watcher = new QFutureWatcher<bool>(this);
-    connect(watcher, &QFutureWatcher<bool>::finished, this, [this, watcher, sourceName]() {
-        if (!m_isStopping.load()) {
-            bool success = watcher->result();
-            onSourceConnected(sourceName, success);
-        }
-        watcher->deleteLater();
-        m_pendingConnections.erase(sourceName);
-    });
-    
-    watcher->setFuture(future);
+    // Run connection on the connect pool, report back on the GUI thread
+    // (a queued call to 'this' is dropped if the controller is gone)
+    m_pendingConnections[sourceName] = m_connectPool.submit(ThreadPool::track,
+        [this, sourcePtr, sourceName]() {
+            bool success = sourcePtr->openSource();
+            QMetaObject::invokeMethod(this, [this, sourceName, success]() {
+                if (!m_isStopping.load()) {
+                    onSourceConnected(sourceName, success);
+                }
+                m_pendingConnections.erase(sourceName);
+            }, Qt::QueuedConnection);
+        });
 }
 
 void TelemetryAppController::onSourceConnected(const QString &sourceName, bool success)
@@ -556,13 +553,13 @@ void TelemetryAppController::pollTelemetry()
                 }
             }
             
-            double value = 0.0;
-            try {
-                value = std::stod(data);
-            } catch (...) {
-                qWarning() << "Failed to parse telemetry data:" << QString::fromStdString(data);
+            // Same parse stage as the formatters; failures are counted and reported rate-limited
+            const SampleParseResult parsed = SampleParser::parse(data);
+            if (!parsed) {
+                SampleParser::report(parsed.error, data);
                 continue;
             }
+            double value = parsed.value;
             
             QString type = pd.telemetryType;
             QString timestamp = QDateTime::currentDateTime().toString("yyyy-MM-dd hh:mm:ss");
@@ -572,13 +569,12 @@ void TelemetryAppController::pollTelemetry()
             std::optional<LogMessage> logMsg;
             
             if (type == "CPU" && m_cpuFormatter) {
-                logMsg = m_cpuFormatter->formatDataToLogMsg(data);
+                logMsg = m_cpuFormatter->formatValueToLogMsg(parsed.value);
             } else if (type == "GPU" && m_gpuFormatter) {
-                logMsg = m_gpuFormatter->formatDataToLogMsg(data);
+                logMsg = m_gpuFormatter->formatValueToLogMsg(parsed.value);
             } else if (type == "RAM" && m_ramFormatter) {
                 double ramPercentage = getRamPercentage(value);
-                std::string percentStr = std::to_string(ramPercentage);
-                logMsg = m_ramFormatter->formatDataToLogMsg(percentStr);
+                logMsg = m_ramFormatter->formatValueToLogMsg(static_cast<float>(ramPercentage));
             }
             
             severity = determineSeverity(type, value);
@@ -3,6 +3,9 @@
 #include <string>
 #include <vector>
 #include <cstdint>
+#include "enums/LogBufferType.hpp"
+#include "enums/LogFormat.hpp"
+#include "enums/LogOverflowPolicy.hpp"
 
 namespace telemetry {
 
@@ -21,7 +24,8 @@ enum class TelemetryType {
 enum class SourceType {
     FILE,
     SOCKET,
-    SOMEIP
+    SOMEIP,
+    LISTENER
 };
 
 /**
@@ -40,6 +44,36 @@ struct SourceConfig {
     std::string path;
     TelemetryType telemetryType;
     uint32_t rateMs;
+
+    // Runtime policy: set when the source has its own "warning"/"critical"/"unit"
+    // or a "telemetryType" other than CPU/GPU/RAM (a new metric kind)
+    bool customPolicy = false;
+    std::string metricName;         // "telemetryType" as written, e.g. "TEMP"
+    float warning = 0.0f;
+    float critical = 0.0f;
+    std::string unit;
+
+    // Optional "debounce" object: report severity changes and heartbeats only
+    float hysteresis = 0.0f;
+    uint32_t minDwellMs = 0;
+    uint32_t heartbeatMs = 0;
+
+    // "windowMs": one rollup (count/min/max/mean/percentiles) per window instead of
+    // every sample; 0 = off. Takes precedence over "debounce"
+    uint32_t windowMs = 0;
+
+    // Socket sources: "readTimeoutMs" - reconnect when no line arrives for this
+    // long (0 = never); optional "reconnect" object - backoff between attempts
+    uint32_t readTimeoutMs = 0;
+    uint32_t reconnectMinMs = 100;
+    uint32_t reconnectMaxMs = 30000;
+
+    // Listener sources ("type": "listener"): producers connect to 'path'. A line
+    // labeled with a route's "tag" (e.g. "TEMP: 71.5") is formatted by that route;
+    // any other line by the listener's own telemetryType/policy
+    uint32_t maxConnections = 256;
+    std::string tag;                        // Route: label to match (default: its telemetryType)
+    std::vector<SourceConfig> routes;
 };
 
 /**
@@ -48,6 +82,22 @@ struct SourceConfig {
 struct SinkConfigData {
     SinkType sinkType;
     std::string path;
+    size_t flushBytes = 64 * 1024;      // File sink: write once this much is buffered
+    uint32_t flushIntervalMs = 1000;    // File sink: ...or once this much time has passed
+    LogFormat_enum format = LogFormat_enum::TEXT;
+};
+
+/**
+ * @brief LogManager configuration
+ */
+struct LoggerConfig {
+    size_t bufferSize = 100;
+    size_t threadPoolSize = 4;
+    size_t batchSize = 64;
+    LogBufferType_enum bufferType = LogBufferType_enum::MUTEX;
+    LogOverflowPolicy_enum overflowPolicy = LogOverflowPolicy_enum::DROP_NEWEST;
+    uint32_t blockTimeoutMs = 10;
+    uint32_t sampleEvery = 10;
 };
 
 /**
@@ -57,6 +107,7 @@ struct AppConfig {
     std::string appName;
     std::vector<SourceConfig> sources;
     std::vector<SinkConfigData> sinks;
+    LoggerConfig logger;
 };
 
 /**
@@ -79,4 +130,19 @@ SourceType stringToSourceType(const std::string& str);
  */
 SinkType stringToSinkType(const std::string& str);
 
+/**
+ * @brief Convert string to LogFormat_enum
+ */
+LogFormat_enum stringToLogFormat(const std::string& str);
+
+/**
+ * @brief Convert string to LogBufferType_enum
+ */
+LogBufferType_enum stringToLogBufferType(const std::string& str);
+
+/**
+ * @brief Convert string to LogOverflowPolicy_enum
+ */
+LogOverflowPolicy_enum stringToOverflowPolicy(const std::string& str);
+
 } // namespace telemetry
\ No newline at end of file
@@ -6,24 +6,66 @@
 #include "sources/ITelemetrySource.hpp"
 #include "sinks/ILogSink.hpp"
 #include "formatter/LogFormatter.hpp"
+#include "formatter/PolicyTable.hpp"
+#include "formatter/SeverityDebouncer.hpp"
+#include "formatter/WindowAggregator.hpp"
 #include "formatter/policies/CpuPolicy.hpp"
 #include "formatter/policies/GpuPolicy.hpp"
 #include "formatter/policies/RamPolicy.hpp"
+#include "utils/Backoff.hpp"
+#include "utils/Reactor.hpp"
+#include "utils/TimingWheel.hpp"
 
 #include <memory>
 #include <vector>
 #include <atomic>
 #include <thread>
 #include <chrono>
+#include <string_view>
+
+class ListenerTelemetrySourceImpl;
 
 namespace telemetry {
 
+// Socket sources: reconnected with backoff after a hang-up or a stall
+struct ConnectionState {
+    ConnectionState(Backoff backoff, std::chrono::milliseconds readTimeout)
+        : backoff(backoff), readTimeout(readTimeout) {}
+
+    Backoff backoff;
+    std::chrono::milliseconds readTimeout{0};           // No line for this long: stalled (0: never)
+    std::chrono::steady_clock::time_point lastData;
+    TimingWheel::Id timer = TimingWheel::None;          // Read deadline while connected, retry while not
+    bool connected = false;
+
+    uint64_t connects = 0;
+    uint64_t failedAttempts = 0;
+    uint64_t hangups = 0;
+    uint64_t timeouts = 0;
+};
+
+// Listener sources: lines labeled 'tag' go to sources_[entry] instead
+struct Route {
+    std::string tag;
+    size_t entry;
+};
+
 struct SourceEntry {
     std::unique_ptr<ITelemetrySource> source;
     TelemetryType type;
+    std::optional<PolicyTable::SourceId> policyId;     // Set: format through policyTable_
+    std::optional<SeverityDebouncer> debouncer;        // Set: log severity changes/heartbeats only
+    std::optional<WindowAggregator> window;            // Set: log one rollup per window
+    std::optional<ConnectionState> connection;         // Set: reconnect when lost
+    std::vector<Route> routes;                         // Listener: per-label entries (no source of their own)
+    ListenerTelemetrySourceImpl* listener = nullptr;   // Listener: same object as source, for its counters
     uint32_t rateMs;
-    std::chrono::steady_clock::time_point lastRead;
     std::string name;
+
+    // Registrations while the loop runs
+    int watchedFd = -1;                                 // Data-driven: the source's descriptor
+    TimingWheel::Id readTimer = TimingWheel::None;      // Polled: every rateMs
+    TimingWheel::Id windowTimer = TimingWheel::None;    // Closes the rollup window
 };
 
 class TelemetryApp {
@@ -42,26 +84,53 @@ public:
 private:
     void initialize();
     void createSources();
+    void createStages(SourceEntry& entry, const SourceConfig& srcCfg);
     void createSinks();
     void openSources();
     void mainLoop();
-    void processSource(SourceEntry& entry);
-    std::optional<LogMessage> formatData(const std::string& data, TelemetryType type);
+    void processSource(SourceEntry& entry, std::chrono::steady_clock::time_point now);
+    void drainSource(SourceEntry& entry, uint32_t events);
+    SourceEntry& routeOf(SourceEntry& entry, std::string_view data);
+    void handleSample(SourceEntry& entry, std::string_view data, std::chrono::steady_clock::time_point now);
+    std::optional<LogMessage> formatData(std::string_view data, const SourceEntry& entry);
+    void closeWindow(SourceEntry& entry);
+    void runScheduler();
+    void rearmScheduler();
+    bool watchSource(SourceEntry& entry);
+    void connectSource(SourceEntry& entry);
+    void disconnectSource(SourceEntry& entry, const char* reason);
+    void checkConnection(SourceEntry& entry, std::chrono::steady_clock::time_point now);
+    void scheduleConnectionTimer(SourceEntry& entry, std::chrono::milliseconds delay);
     void printBanner();
 
 private:
+    // Lines handled per readiness event before other sources get a turn
+    static constexpr size_t MaxLinesPerWake = 256;
+
     AppConfig config_;
 
     std::unique_ptr<LogFormatter<CpuPolicy>> cpuFormatter_;
     std::unique_ptr<LogFormatter<GpuPolicy>> gpuFormatter_;
     std::unique_ptr<LogFormatter<RamPolicy>> ramFormatter_;
 
+    // Sources with thresholds/metric kinds from the config
+    std::unique_ptr<PolicyTable> policyTable_;
+
     // LogManager owns the sinks - we just keep count
     std::unique_ptr<LogManager> logManager_;
     size_t sinkCount_ = 0;
     
     std::vector<SourceEntry> sources_;
 
+    // mainLoop: waits on source descriptors and on one timer for the scheduler
+    std::unique_ptr<Reactor> reactor_;
+
+    // Polled sources, rollup windows and connections: tag = index * TimerKinds + kind
+    enum TimerKind : uint32_t { ReadTimer, WindowTimer, ConnectionTimer, TimerKinds };
+    TimingWheel scheduler_;
+    Reactor::TimerId schedulerTimer_ = -1;
+    bool schedulerRunning_ = false;     // In advance(): runScheduler re-arms once at the end
+
     std::atomic<bool> running_{false};
 };
 
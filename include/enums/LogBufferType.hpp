@@ -0,0 +1,9 @@
+#pragma once
+
+
+// Backing store used by LogManager for queued messages
+enum class LogBufferType_enum {
+    MUTEX,      // RingBuffer: one mutex around every operation
+    SPSC,       // SpscRingBuffer: lock-free, single producer / single consumer
+    MPMC        // MpmcRingBuffer: lock-free, any number of producers
+};
@@ -0,0 +1,8 @@
+#pragma once
+
+
+// How a sink renders a LogMessage (LogMessage::Render caches one line per format)
+enum class LogFormat_enum {
+    TEXT,   // [time] <severity> (app - context) : message
+    JSON    // One object per line: time, timestampNs, severity, app, context, message
+};
@@ -0,0 +1,11 @@
+#pragma once
+
+
+// What LogManager::log() does when the message buffer is full
+// (CRITICAL messages are never dropped, whatever the policy)
+enum class LogOverflowPolicy_enum {
+    BLOCK,          // Wait for free space, up to a timeout, then drop
+    DROP_NEWEST,    // Drop the incoming message
+    DROP_OLDEST,    // Overwrite: evict the oldest queued message
+    SAMPLE          // Under pressure keep only 1 in N messages
+};
@@ -0,0 +1,12 @@
+#pragma once 
+
+#include <cstdint>
+
+// Why SampleParser::parse() rejected a raw telemetry line
+enum class SampleParseError_enum : uint8_t {
+    NONE,               // Parsed
+    EMPTY,              // Nothing but whitespace
+    NO_NUMBER,          // No number where one was expected (or nan/inf)
+    OUT_OF_RANGE,       // Does not fit in a float
+    TRAILING_GARBAGE    // Something other than a unit follows the number
+};
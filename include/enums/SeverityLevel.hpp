@@ -1,7 +1,9 @@
 #pragma once 
 
-// Severity levels for log messages
-enum class SeverityLvl_enum {
+#include <cstdint>
+
+// Severity levels for log messages (one byte: stored in every LogMessage)
+enum class SeverityLvl_enum : uint8_t {
     CRITICAL,   // Immediate action required
     WARNING,    // Warning condition
     INFO        // Informational
@@ -0,0 +1,10 @@
+#pragma once 
+
+#include <cstdint>
+
+// Instruction set a batch kernel runs with (picked at runtime from the CPU)
+enum class SimdKernel_enum : uint8_t {
+    SCALAR,     // Plain C++, any CPU
+    SSE2,       // 4 floats per instruction
+    AVX2        // 8 floats per instruction
+};
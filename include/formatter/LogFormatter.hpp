@@ -1,50 +1,80 @@
 # pragma once 
 
 #include <string>
+#include <string_view>
 #include <sstream>
 #include <iomanip>
 #include <chrono>
 #include <optional>
 #include <iostream>
-#include "../third_party/magic_enum.hpp"
 #include "logger/LogMessage.hpp"
+#include "logger/StringInterner.hpp"
 #include "formatter/LogFormatterHelper.hpp"
+#include "formatter/PolicyText.hpp"
+#include "formatter/SampleParser.hpp"
+#include "formatter/WindowAggregator.hpp"
 
 template <typename _PolicyType>
 class LogFormatter {
     private:
         std::string AppName;
-        
-        std::string GetContext(){
-            return (std::string(magic_enum::enum_name(_PolicyType::context)));
-        }
+        StringInterner::Id AppId;                   // Interned once, carried by every message
+        LogMessage::SampleFormat Format;            // Constant text, for the sink to render later
 
     public :
         LogFormatter() = delete;
-        LogFormatter(const std::string &CopyAppName):AppName{CopyAppName}{}
+        LogFormatter(const std::string &CopyAppName)
+            : AppName{CopyAppName}
+            , AppId{StringInterner::instance().intern(CopyAppName)} {
+            StringInterner& interner = StringInterner::instance();
+            Format.bodyPrefix = interner.intern(PolicyText<_PolicyType>::bodyPrefix);
+            Format.unit = interner.intern(PolicyText<_PolicyType>::unit);
+            Format.sourcePrefix = interner.intern("(" + AppName + std::string(PolicyText<_PolicyType>::sourceSuffix));
+        }
         LogFormatter(const LogFormatter & other ) = delete;
         LogFormatter& operator=(const LogFormatter& other) = delete;
         LogFormatter(LogFormatter &&other) = default;
         LogFormatter& operator=(LogFormatter && other) = default;
         ~LogFormatter() = default;
 
-        std::optional<LogMessage> formatDataToLogMsg(const std::string& raw){
-            try {
-                float value = std::stof(raw); // Converts the string to a float
-
-                return LogMessage(
-                    AppName,
-                    GetContext(),
-                    LogFormatterHelper::GetSeverity(value,_PolicyType::CRITICAL,_PolicyType::WARNING),
-                    LogFormatterHelper::GetCurrentTimeStamp(),
-                    LogFormatterHelper::GetDescription(value,GetContext(),_PolicyType::unit)
-                );
-            } catch (const std::invalid_argument& e) {
-                std::cerr << "Error: Invalid argument - " << e.what() << std::endl;
-                return std::nullopt;
-            } catch (const std::out_of_range& e) {
-                std::cerr << "Error: Out of range - " << e.what() << std::endl;
+        /**
+         * @brief Parses a raw line (see SampleParser) and builds the message;
+         * nullopt (counted, rarely printed) when the line is not a sample
+         */
+        std::optional<LogMessage> formatDataToLogMsg(std::string_view raw){
+            const SampleParseResult parsed = SampleParser::parse(raw);
+            if (!parsed) {
+                SampleParser::report(parsed.error, raw);
                 return std::nullopt;
             }
+            return formatValueToLogMsg(parsed.value);
+        }
+
+        /**
+         * @brief For callers that already hold the value
+         */
+        LogMessage formatValueToLogMsg(float value){
+            // Lazy message: the description is rendered by the sink that writes it
+            return LogMessage(
+                AppId,
+                _PolicyType::context,
+                LogFormatterHelper::GetSeverityLevel(value,_PolicyType::CRITICAL,_PolicyType::WARNING),
+                LogFormatterHelper::GetCurrentTimeNs(),
+                value,
+                Format
+            );
+        }
+
+        /**
+         * @brief One rollup record for a closed window; classified by its maximum
+         */
+        LogMessage formatWindowToLogMsg(const WindowSummary &summary){
+            return LogMessage(
+                AppId,
+                _PolicyType::context,
+                LogFormatterHelper::GetSeverityLevel(summary.max,_PolicyType::CRITICAL,_PolicyType::WARNING),
+                LogFormatterHelper::GetCurrentTimeNs(),
+                LogFormatterHelper::GetWindowDescription(summary,PolicyText<_PolicyType>::context,_PolicyType::unit)
+            );
         }
 };
\ No newline at end of file
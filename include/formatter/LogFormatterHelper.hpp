@@ -3,8 +3,11 @@
 
 #pragma once 
 
+#include <cstdint>
 #include <string>  
 #include <string_view> 
+#include "enums/SeverityLevel.hpp"
+#include "formatter/WindowAggregator.hpp"
 
 class LogFormatterHelper{
 
@@ -17,7 +20,12 @@ class LogFormatterHelper{
         ~LogFormatterHelper() = default;
 
         static std::string GetDescription(float value,const std::string &context,const std::string_view& unit);
+        // "CPUusage[5000ms] : n=50 min=12.00% mean=..% max=..% p50=..% p95=..% p99=..%"
+        // plus " warning=W critical=C" when the window was classified
+        static std::string GetWindowDescription(const WindowSummary& summary,std::string_view context,std::string_view unit);
         static std::string GetSeverity(float value,float criticalThreshold,float warningThreshold);
+        static SeverityLvl_enum GetSeverityLevel(float value,float criticalThreshold,float warningThreshold);
         static std::string GetCurrentTimeStamp();
+        static int64_t GetCurrentTimeNs();
 
 };
\ No newline at end of file
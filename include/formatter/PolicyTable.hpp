@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "enums/SeverityLevel.hpp"
+#include "formatter/PolicyText.hpp"
+#include "formatter/WindowAggregator.hpp"
+#include "logger/LogMessage.hpp"
+#include "logger/StringInterner.hpp"
+
+/**
+ * @brief Threshold policies defined at runtime (e.g. from app_config.json)
+ *
+ * The runtime counterpart of LogFormatter<_PolicyType>: one row per
+ * source, looked up by the SourceId add() returned. Rows are small
+ * (16 bytes) and stored contiguously, so a lookup is one indexed load;
+ * every string a message needs is interned once in add().
+ *
+ * Built-in types with their built-in thresholds should keep using
+ * LogFormatter<_PolicyType>; use this table for per-source thresholds
+ * and metric kinds that have no policy struct.
+ *
+ * Not synchronized: add() everything during setup, then only read.
+ */
+class PolicyTable {
+    public:
+        using SourceId = uint16_t;
+
+        PolicyTable() = delete;
+        explicit PolicyTable(const std::string &appName);
+        PolicyTable(const PolicyTable &other) = delete;
+        PolicyTable& operator=(const PolicyTable &other) = delete;
+        PolicyTable(PolicyTable &&other) = default;
+        PolicyTable& operator=(PolicyTable &&other) = default;
+        ~PolicyTable() = default;
+
+        /**
+         * @param context Shown in messages ("CPU", "TEMP", ...)
+         * @return Id of the new row
+         */
+        SourceId add(std::string_view context, std::string_view unit, float warning, float critical);
+
+        // A row with a built-in policy's values (to override one field, copy them)
+        template <typename _PolicyType>
+        SourceId add() {
+            return add(PolicyText<_PolicyType>::context, _PolicyType::unit,
+                       _PolicyType::WARNING, _PolicyType::CRITICAL);
+        }
+
+        size_t size() const { return entries.size(); }
+
+        /**
+         * @brief Same classification as LogFormatterHelper::GetSeverityLevel
+         * @param id Must come from add()
+         */
+        SeverityLvl_enum classify(SourceId id, float value) const {
+            const Entry& entry = entries[id];
+            if (value > entry.critical) return SeverityLvl_enum::CRITICAL;
+            if (value > entry.warning)  return SeverityLvl_enum::WARNING;
+            return SeverityLvl_enum::INFO;
+        }
+
+        /**
+         * @param id Must come from add()
+         */
+        LogMessage formatValueToLogMsg(SourceId id, float value) const;
+
+        /**
+         * @brief Parses with SampleParser; nullopt for an unparsable line or unknown id
+         */
+        std::optional<LogMessage> formatDataToLogMsg(SourceId id, std::string_view raw) const;
+
+        /**
+         * @brief One rollup record for a closed window; classified by its maximum
+         * @param id Must come from add()
+         */
+        LogMessage formatWindowToLogMsg(SourceId id, const WindowSummary& summary) const;
+
+    private:
+        struct Entry {
+            float warning;
+            float critical;
+            StringInterner::Id contextId;
+            LogMessage::SampleFormat format;
+        };
+
+        std::string AppName;
+        StringInterner::Id AppId;
+        std::vector<Entry> entries;
+};
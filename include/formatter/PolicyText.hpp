@@ -0,0 +1,104 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include "enums/TelemetrySource.hpp"
+
+namespace policytext_detail {
+
+    // A string built at compile time; lives in .rodata
+    template <size_t N>
+    struct FixedString {
+        char data[N + 1] = {};
+
+        constexpr std::string_view view() const { return std::string_view(data, N); }
+    };
+
+    template <size_t... Sizes>
+    constexpr FixedString<(Sizes + ...)> concat(const std::string_view (&parts)[sizeof...(Sizes)]) {
+        FixedString<(Sizes + ...)> result;
+        size_t pos = 0;
+        for (std::string_view part : parts) {
+            for (char c : part) {
+                result.data[pos++] = c;
+            }
+        }
+        return result;
+    }
+
+    constexpr std::string_view contextName(TelemetrySrc_enum context) {
+        switch (context) {
+            case TelemetrySrc_enum::CPU: return "CPU";
+            case TelemetrySrc_enum::GPU: return "GPU";
+            case TelemetrySrc_enum::RAM: return "RAM";
+        }
+        return "?";
+    }
+
+}
+
+/**
+ * @brief The one writer of a sample message body: prefix + value + unit
+ *
+ *   "CPUusage : " + 91.0f + "%"  ->  "CPUusage : 91.000000%"
+ *
+ * The number goes through to_chars with the same digits as
+ * std::to_string(float). LogFormatterHelper::GetDescription and the lazy
+ * LogMessage text both render through AppendBody, so they cannot drift.
+ */
+struct SampleText {
+    // "-" + 39 integer digits (FLT_MAX) + "." + 6 decimals
+    static constexpr size_t MaxValueLength = 48;
+
+    static constexpr size_t MaxBodyLength(std::string_view prefix, std::string_view unit) {
+        return prefix.size() + MaxValueLength + unit.size();
+    }
+
+    /**
+     * @param out At least MaxBodyLength(prefix, unit) bytes; not NUL-terminated
+     * @return Number of bytes written
+     */
+    static size_t WriteBody(std::string_view prefix, float value, std::string_view unit, char* out) {
+        std::memcpy(out, prefix.data(), prefix.size());
+        char* pos = out + prefix.size();
+        pos = std::to_chars(pos, pos + MaxValueLength, value, std::chars_format::fixed, 6).ptr;
+        std::memcpy(pos, unit.data(), unit.size());
+        return static_cast<size_t>(pos - out) + unit.size();
+    }
+
+    // Writes the body straight into the end of 'out'
+    static void AppendBody(std::string& out, std::string_view prefix, float value, std::string_view unit) {
+        const size_t start = out.size();
+        out.resize(start + MaxBodyLength(prefix, unit));
+        out.resize(start + WriteBody(prefix, value, unit, &out[start]));
+    }
+};
+
+/**
+ * @brief The constant text of a policy's messages, fixed at compile time
+ *
+ *   PolicyText<CpuPolicy>::bodyPrefix  == "CPUusage : "
+ *   PolicyText<CpuPolicy>::sourceSuffix == " - CPU)"   ("(appName" goes in front)
+ *
+ * LogFormatter interns these once; the body itself is rendered by SampleText.
+ */
+template <typename _PolicyType>
+struct PolicyText {
+    static constexpr std::string_view context = policytext_detail::contextName(_PolicyType::context);
+    static constexpr std::string_view unit = _PolicyType::unit;
+
+private:
+    static constexpr std::string_view bodyParts[] = {context, "usage : "};
+    static constexpr std::string_view sourceParts[] = {" - ", context, ")"};
+    static constexpr auto bodyPrefixText =
+        policytext_detail::concat<bodyParts[0].size(), bodyParts[1].size()>(bodyParts);
+    static constexpr auto sourceSuffixText =
+        policytext_detail::concat<sourceParts[0].size(), sourceParts[1].size(), sourceParts[2].size()>(sourceParts);
+
+public:
+    static constexpr std::string_view bodyPrefix = bodyPrefixText.view();
+    static constexpr std::string_view sourceSuffix = sourceSuffixText.view();
+};
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Streaming estimate of one quantile in constant space (P-square)
+ *
+ * Jain & Chlamtac's P^2 algorithm: five markers track the minimum, the
+ * quantile, the maximum and two points between, and are moved with a
+ * piecewise-parabolic fit as samples arrive. O(1) per sample, no
+ * allocation: four arrays of 5 doubles (heights, actual and desired
+ * positions, increments), about 180 bytes. Exact until the fifth sample.
+ */
+class QuantileSketch {
+    public:
+        explicit QuantileSketch(double quantile);
+
+        void add(float value);
+        float estimate() const;     // 0 when empty
+        uint64_t count() const { return samples; }
+        void reset();
+
+    private:
+        static constexpr int Markers = 5;
+
+        double parabolic(int i, int d) const;
+        double linear(int i, int d) const;
+
+        double quantile;
+        uint64_t samples = 0;
+        double heights[Markers] = {};
+        double positions[Markers] = {};             // Actual marker positions (1-based)
+        double desired[Markers] = {};               // Where they should be
+        double increments[Markers] = {};            // Of 'desired', per sample
+};
@@ -0,0 +1,48 @@
+#pragma once 
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+#include "enums/SampleParseError.hpp"
+
+struct SampleParseResult {
+    float value = 0.0f;
+    SampleParseError_enum error = SampleParseError_enum::NONE;
+
+    explicit operator bool() const { return error == SampleParseError_enum::NONE; }
+};
+
+/**
+ * @brief The one parse stage for raw telemetry lines
+ *
+ * std::from_chars based: no allocation, no exceptions. Accepted form:
+ *   [whitespace] [label ':'] [whitespace] number [whitespace] [unit] [whitespace]
+ * e.g. "42.5", " 12\n", "CPU: 12%", "GPU (simulated): 45%", "USED_MB: 2048",
+ * "3.5 GB". A label starts with a letter; a unit is letters or '%'.
+ *
+ * Failures are counted per SampleParseError_enum by report(). At most
+ * one summary line per ReportInterval goes to std::cerr, so a source
+ * spewing garbage cannot flood the console.
+ */
+class SampleParser {
+    public:
+        static constexpr std::chrono::seconds ReportInterval{10};
+
+        static SampleParseResult parse(std::string_view text);
+
+        /**
+         * @brief Counts a failed parse; prints a rate-limited summary
+         */
+        static void report(SampleParseError_enum error, std::string_view text);
+
+        static uint64_t errorCount(SampleParseError_enum error);
+        static uint64_t errorCount();       // All kinds
+
+    private:
+        static constexpr size_t ErrorKinds = 5;
+
+        static std::atomic<uint64_t> errors[ErrorKinds];
+        static std::atomic<uint64_t> reportedErrors;        // Total at the last summary
+        static std::atomic<int64_t> lastReportNs;           // steady_clock
+};
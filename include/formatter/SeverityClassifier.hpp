@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "enums/SeverityLevel.hpp"
+#include "enums/SimdKernel.hpp"
+
+// How many samples of a batch fell in each class
+struct SeverityCounts {
+    size_t critical = 0;
+    size_t warning = 0;
+    size_t info = 0;
+
+    size_t operator[](SeverityLvl_enum level) const {
+        switch (level) {
+            case SeverityLvl_enum::CRITICAL: return critical;
+            case SeverityLvl_enum::WARNING:  return warning;
+            case SeverityLvl_enum::INFO:     return info;
+        }
+        return 0;
+    }
+    size_t total() const { return critical + warning + info; }
+};
+
+/**
+ * @brief Classifies arrays of samples (replay, socket bursts, aggregation windows)
+ *
+ * Same rule as LogFormatterHelper::GetSeverityLevel, element by element:
+ * value > critical -> CRITICAL, else value > warning -> WARNING, else INFO
+ * (NaN is INFO). The kernel is branch-free and uses the widest instruction
+ * set the CPU offers - AVX2, SSE2 or scalar - chosen once at runtime, so
+ * the library needs no -mavx2 and still runs on older CPUs.
+ *
+ *   SeverityLvl_enum levels[n];
+ *   SeverityCounts counts = SeverityClassifier::classify(values, n,
+ *                               CpuPolicy::CRITICAL, CpuPolicy::WARNING, levels);
+ */
+class SeverityClassifier {
+    public:
+        /**
+         * @param out n entries, or nullptr to only count
+         */
+        static SeverityCounts classify(const float* values, size_t n,
+                                       float criticalThreshold, float warningThreshold,
+                                       SeverityLvl_enum* out = nullptr);
+
+        template <typename _PolicyType>
+        static SeverityCounts classify(const float* values, size_t n, SeverityLvl_enum* out = nullptr) {
+            return classify(values, n, _PolicyType::CRITICAL, _PolicyType::WARNING, out);
+        }
+
+        /**
+         * @brief Forces a kernel (benchmarks, cross-checks); one the CPU
+         * lacks falls back to the best supported one below it
+         */
+        static SeverityCounts classifyWith(SimdKernel_enum kernel, const float* values, size_t n,
+                                           float criticalThreshold, float warningThreshold,
+                                           SeverityLvl_enum* out = nullptr);
+
+        // The kernel classify() uses on this CPU
+        static SimdKernel_enum kernel();
+        static bool supported(SimdKernel_enum kernel);
+};
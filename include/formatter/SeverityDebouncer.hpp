@@ -0,0 +1,68 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include "enums/SeverityLevel.hpp"
+#include "logger/LogMessage.hpp"
+
+struct DebounceConfig {
+    float hysteresis = 0.0f;                    // How far below a threshold a value must fall to leave its level
+    std::chrono::milliseconds minDwell{0};      // How long a new level must hold before it is reported (not CRITICAL)
+    std::chrono::milliseconds heartbeat{0};     // Re-report the current level this often; 0 = never
+
+    bool enabled() const {
+        return hysteresis > 0.0f || minDwell.count() > 0 || heartbeat.count() > 0;
+    }
+};
+
+/**
+ * @brief Optional stage between a formatter and LogManager::log that
+ * only lets severity changes (and heartbeats) through
+ *
+ * A value hovering around a threshold (CPU at 74.9 / 75.1 with WARNING
+ * at 75) flips INFO <-> WARNING every sample, and each flip is a full
+ * message for every sink. The debouncer keeps one reported level per
+ * source and admits a message only when that level changes:
+ *   - Up: a higher level is taken at its threshold. CRITICAL is taken
+ *     at once; WARNING must hold for minDwell first.
+ *   - Down: the value must fall 'hysteresis' below the threshold of the
+ *     current level, then hold for minDwell.
+ *   - Heartbeat: with nothing admitted for 'heartbeat', the next message
+ *     goes through, carrying the current level.
+ * Messages without a value (text messages) skip the hysteresis band.
+ *
+ * One per source, driven by that source's reads; not synchronized.
+ */
+class SeverityDebouncer {
+    public:
+        SeverityDebouncer(float warningThreshold, float criticalThreshold, const DebounceConfig& config);
+
+        /**
+         * @param message Classified by the formatter; its severity is set to
+         * the reported level when admitted
+         * @param now When the sample was read
+         * @return true if the message should be logged
+         */
+        bool admit(LogMessage& message, std::chrono::steady_clock::time_point now);
+
+        SeverityLvl_enum level() const { return current; }
+        uint64_t admittedCount() const { return admitted; }
+        uint64_t suppressedCount() const { return suppressed; }
+
+    private:
+        SeverityLvl_enum target(const LogMessage& message) const;
+
+        float warningThreshold;
+        float criticalThreshold;
+        DebounceConfig config;
+
+        bool started = false;
+        SeverityLvl_enum current = SeverityLvl_enum::INFO;
+        bool pending = false;                       // Values point to another level, waiting out minDwell
+        SeverityLvl_enum candidate = SeverityLvl_enum::INFO;    // The latest of them
+        std::chrono::steady_clock::time_point candidateSince;
+        std::chrono::steady_clock::time_point lastAdmitted;
+
+        uint64_t admitted = 0;
+        uint64_t suppressed = 0;
+};
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include "formatter/QuantileSketch.hpp"
+#include "formatter/SeverityClassifier.hpp"
+
+// One closed window of samples
+struct WindowSummary {
+    uint64_t count = 0;
+    float min = 0.0f;
+    float max = 0.0f;
+    float mean = 0.0f;
+    float p50 = 0.0f;
+    float p95 = 0.0f;
+    float p99 = 0.0f;
+    std::chrono::milliseconds length{0};        // Configured window length
+    bool classified = false;                    // Aggregator has thresholds: the counts below are set
+    uint64_t warning = 0;                       // Samples at WARNING
+    uint64_t critical = 0;                      // Samples at CRITICAL
+};
+
+/**
+ * @brief Accumulates a source's samples over a fixed window, for one
+ * rollup record per window instead of one message per sample
+ *
+ * Fixed size, no allocation: count/min/max/sum, the first ExactSamples
+ * values (percentiles are exact while the window holds no more), and a
+ * QuantileSketch per percentile for longer windows. Given thresholds, it
+ * also counts WARNING/CRITICAL samples: values are staged in blocks of
+ * BatchSamples and classified by SeverityClassifier a block at a time.
+ *
+ * The window opens with its first sample; due() once it is 'length'
+ * old. summary() then reset() - empty windows produce nothing.
+ * One per source; not synchronized.
+ */
+class WindowAggregator {
+    public:
+        static constexpr size_t ExactSamples = 64;
+        static constexpr size_t BatchSamples = 64;
+
+        explicit WindowAggregator(std::chrono::milliseconds length);
+        // Also counts samples per severity (same rule as LogFormatterHelper::GetSeverityLevel)
+        WindowAggregator(std::chrono::milliseconds length, float warningThreshold, float criticalThreshold);
+
+        void add(float value, std::chrono::steady_clock::time_point now);
+        bool due(std::chrono::steady_clock::time_point now) const;
+        uint64_t count() const { return samples; }
+        std::chrono::milliseconds length() const { return windowLength; }
+
+        WindowSummary summary() const;
+        void reset();
+
+    private:
+        void classifyPending();
+
+        std::chrono::milliseconds windowLength;
+        std::chrono::steady_clock::time_point opened;
+
+        uint64_t samples = 0;
+        float minimum = 0.0f;
+        float maximum = 0.0f;
+        double sum = 0.0;
+        float exact[ExactSamples];
+        QuantileSketch p50{0.50};
+        QuantileSketch p95{0.95};
+        QuantileSketch p99{0.99};
+
+        bool classifying = false;
+        float warningThreshold = 0.0f;
+        float criticalThreshold = 0.0f;
+        SeverityCounts levels;                  // Classified blocks of this window
+        size_t pendingCount = 0;
+        float pending[BatchSamples];            // Not yet classified
+};
@@ -1,33 +1,111 @@
 #pragma once
 
+#include <array>
+#include <chrono>
+#include <cstdint>
 #include <vector>
 #include <memory>
 #include <thread>
 #include <atomic>
 #include <mutex>
+#include <variant>
+#include <optional>
 #include <condition_variable>
 
 #include "../utils/RingBuffer.hpp"
+#include "../utils/SpscRingBuffer.hpp"
+#include "../utils/MpmcRingBuffer.hpp"
+#include "enums/LogBufferType.hpp"
+#include "enums/LogOverflowPolicy.hpp"
+#include "enums/SeverityLevel.hpp"
 #include "logger/LogMessage.hpp"
 #include "sinks/ILogSink.hpp"
 #include "utils/ThreadPool.hpp"
 
 
+// How log() behaves when the buffer is full
+struct LogOverflowConfig {
+    LogOverflowPolicy_enum policy = LogOverflowPolicy_enum::DROP_NEWEST;
+    std::chrono::milliseconds blockTimeout{10};     // BLOCK: longest a producer waits for space
+    uint32_t sampleEvery = 10;                      // SAMPLE: keep 1 in N above the high watermark
+};
+
 class LogManager {
     private :
-        std::vector<std::unique_ptr<ILogSink>> SinksBuffer;
-        RingBuffer<LogMessage> LogMessagesBuffer;
+        using LogBuffer = std::variant<RingBuffer<LogMessage>,
+                                       SpscRingBuffer<LogMessage>,
+                                       MpmcRingBuffer<LogMessage>>;
+
+        // Each sink gets its own Strand: its batches run in order, one at a time,
+        // while different sinks still write in parallel on the pool
+        struct SinkEntry {
+            std::unique_ptr<ILogSink> sink;
+            std::unique_ptr<Strand> strand;
+            std::chrono::milliseconds flushInterval;            // From the sink (0: never)
+            std::chrono::steady_clock::time_point nextFlush;    // Worker: next timed flush()
+        };
+
+        std::vector<SinkEntry> SinksBuffer;
+        LogBuffer LogMessagesBuffer;
         std::thread FlushingThread;
         std::atomic<bool> stopFlushing;
-        std::mutex mx;
+        std::atomic<bool> discardPending;   // DeleteAllLogMessages() request for the worker (SPSC)
+        std::atomic<bool> workerWaiting;    // Worker is about to block on cv
+        std::mutex mx;                      // Guards cv only: producers take it just to wake the worker
+        std::mutex producerMx;              // Serializes producers in SPSC mode
+        std::mutex consumerMx;              // Worker vs evicting producers: the oldest is inspected before it is taken
         std::condition_variable cv;
         ThreadPool threadPool;
 
+        // Overflow handling
+        LogOverflowConfig overflowConfig;
+        std::mutex spaceMx;                         // Guards spaceCv only
+        std::condition_variable spaceCv;            // Worker -> producers: slots were freed
+        std::atomic<uint32_t> producersWaiting;     // Producers blocked on spaceCv
+        std::atomic<uint32_t> sampleCounter;
+        std::atomic<uint64_t> enqueuedCount;
+        std::array<std::atomic<uint64_t>, 3> droppedCount;   // Indexed by SeverityLvl_enum
+
+        // Most messages the worker takes from the buffer in one pass
+        std::atomic<size_t> batchSize;
+
+        // flush() watermark: every message below this buffer position has
+        // been handed to the sink strands (or evicted/discarded)
+        std::atomic<uint64_t> dispatchedCount;
+        std::atomic<bool> flushRequested;       // flush() -> worker: publish dispatchedCount
+        std::mutex flushMx;                     // Guards flushCv only
+        std::condition_variable flushCv;        // Worker -> flush(): watermark moved
+        std::atomic<uint32_t> flushWaiters;
+
+        static LogBuffer makeBuffer(size_t capacity, LogBufferType_enum bufferType);
+
+        bool bufferPush(const LogMessage &log_message);
+        std::optional<LogMessage> bufferPopUnlessCritical();
+        size_t bufferDrain(std::vector<LogMessage> &out, size_t max);
+        size_t bufferPushCount() const;
+        size_t bufferPopCount() const;
+        bool bufferEmpty() const;
+        bool bufferIsSpsc() const;
+        void wakeWorker();
+        void notifySpace();
+        void publishDispatched();
+        std::optional<std::chrono::steady_clock::time_point> nextSinkFlush() const;
+        void flushDueSinks();
+        bool flushUntil(std::optional<std::chrono::steady_clock::time_point> deadline);
+
+        bool pushSerialized(const LogMessage &log_message);
+        bool pushBlocking(const LogMessage &log_message,
+                          std::optional<std::chrono::steady_clock::time_point> deadline);
+        bool pushEvictingOldest(const LogMessage &log_message);
+        bool admitSample();
+        void countDrop(SeverityLvl_enum severity);
 
 
     public:
-        LogManager() = delete;
-        LogManager(size_t LogBufferCapacity=100, size_t threadPoolSize=5);
+        static constexpr size_t DefaultBatchSize = 64;
+
+        LogManager(size_t LogBufferCapacity=100, size_t threadPoolSize=5,
+                   LogBufferType_enum bufferType=LogBufferType_enum::MUTEX);
         LogManager(const LogManager& other) = delete;
         LogManager(LogManager&& other) = delete;
 
@@ -36,12 +114,32 @@ class LogManager {
 
         void addSink(ILogSink *SinkPtr);
         void removeSink(ILogSink *SinkPtr);
-        void log(const LogMessage &log_message);
+        bool log(const LogMessage &log_message);
+
+        /**
+         * @brief Durability barrier: returns once every message logged before
+         * the call has been written to every sink and each sink's flush() ran
+         *
+         * flush_for() gives up after 'timeout' and returns false.
+         */
         void flush();
+        bool flush_for(std::chrono::milliseconds timeout);
+
         void DeleteAllSinks();
         void DeleteAllLogMessages();
 
+        void setBatchSize(size_t size);
+        size_t getBatchSize() const;
+
+        // Call before logging starts
+        void setOverflowPolicy(const LogOverflowConfig &config);
+        const LogOverflowConfig& getOverflowPolicy() const;
+
+        uint64_t getEnqueuedCount() const;
+        uint64_t getDroppedCount() const;
+        uint64_t getDroppedCount(SeverityLvl_enum severity) const;
+
         void workLoop();
 
         ~LogManager();
-};
\ No newline at end of file
+};
@@ -7,6 +7,12 @@ class LogManagerBuilder {
 private:
     std::unique_ptr<LogManager> PtrToLogManager;
     size_t bufferSize_ = 1000;
+    size_t threadPoolSize_ = 5;
+    LogBufferType_enum bufferType_ = LogBufferType_enum::MUTEX;
+    LogOverflowConfig overflowConfig_;
+    size_t batchSize_ = LogManager::DefaultBatchSize;
+
+    void ensureLogManager();
 
 public:
     // FIXED: Allow default construction for Builder pattern
@@ -21,6 +27,9 @@ public:
     ~LogManagerBuilder() = default;
 
     LogManagerBuilder& setBufferSize(size_t size);
+    LogManagerBuilder& setBufferType(LogBufferType_enum type);
+    LogManagerBuilder& setOverflowPolicy(const LogOverflowConfig& config);
+    LogManagerBuilder& setBatchSize(size_t size);
     LogManagerBuilder& addSink(ILogSink* SinkPtr);
     LogManagerBuilder& addLogMessage(LogMessage& LogMessageRef);
 
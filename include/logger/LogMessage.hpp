@@ -1,14 +1,101 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <optional>
 #include <string>
+#include <string_view>
+#include "enums/LogFormat.hpp"
+#include "enums/SeverityLevel.hpp"
+#include "enums/TelemetrySource.hpp"
+#include "logger/StringInterner.hpp"
+#include "utils/Timestamp.hpp"
 
+/**
+ * @brief One log record, laid out to fit in a cache line
+ *
+ * App name, context and severity label are StringInterner ids, severity
+ * is a SeverityLvl_enum and the time is an int64 nanosecond timestamp
+ * (system clock). Message text up to InlineTextSize bytes is stored in
+ * the object itself, so copying a typical message allocates nothing;
+ * longer text moves to the heap (up to 65535 bytes; longer text is cut
+ * there and counted, see truncatedCount()). 19 bytes of fields, 29 of
+ * inline text and the render-cache pointer: 56 bytes, under one cache
+ * line.
+ *
+ * A LAZY message (sample constructor) carries the raw value and the
+ * SampleFormat ids instead of text. The text ("CPUusage : 91.000000%")
+ * is rendered on the sink side, from the precomputed prefix/unit strings
+ * and to_chars, when GetMessage() or Render() first needs it.
+ *
+ * Render(format) builds the full line once per format and caches it in
+ * the message; rendering is const and thread-safe, so the sinks sharing
+ * one batch (on different pool threads) render each line once between
+ * them. Copies start with an empty cache, moves take it along.
+ *
+ * The five-string constructor interns its names like the typed ones (a
+ * full table is reported once and maps new names to "?"). It and
+ * Render(TEXT) / ToString() keep the original format:
+ *   [time] <severity> (appName - context) : message
+ * Times are shown with milliseconds, except for a time given to the
+ * five-string constructor as "YYYY-MM-DD HH:MM:SS", which is shown as
+ * given. A severity string other than CRITICAL/WARNING/INFO is kept as a
+ * label (and classified as INFO); any other time string is kept verbatim
+ * in front of the text.
+ */
 class LogMessage {
+    public:
+        static constexpr size_t InlineTextSize = 29;
+
+        /**
+         * @brief Interned constant text of a lazy sample (see PolicyText)
+         *
+         * Body: bodyPrefix + value + unit, e.g. "CPUusage : " "91.000000" "%".
+         * sourcePrefix, if set, replaces "(app - context)" in TEXT lines.
+         */
+        struct SampleFormat {
+            StringInterner::Id bodyPrefix = 0;
+            StringInterner::Id unit = 0;
+            StringInterner::Id sourcePrefix = 0;
+        };
+
     private:
-        std::string appName;
-        std::string context;
-        std::string severity;
-        std::string time;
-        std::string message;
+        enum Flags : uint8_t {
+            HeapText = 1 << 0,      // 'text' holds a char* to textSize heap bytes
+            RawTime  = 1 << 1,      // First rawTimeSize bytes of the text are the time string
+            Lazy     = 1 << 2,      // 'text' holds a LazySample, rendered on demand
+            WholeSecond = 1 << 3    // Time was given to the second: show no fraction
+        };
+
+        struct LazySample {
+            float value;
+            SampleFormat format;
+        };
+
+        int64_t timestampNs;                    // Since the Unix epoch
+        StringInterner::Id appId;
+        StringInterner::Id contextId;
+        StringInterner::Id severityLabelId;     // 0 = canonical name of 'severity'
+        uint16_t textSize;
+        SeverityLvl_enum severity;
+        uint8_t flags;
+        uint8_t rawTimeSize;
+        struct RenderCache;
+
+        char text[InlineTextSize];
+        mutable std::atomic<RenderCache*> cache;    // Created by the first render
+
+        const char* textData() const;
+        void assignText(std::string_view first, std::string_view second = {});
+        void releaseText();
+        void copyFrom(const LogMessage& other);
+        void moveFrom(LogMessage& other);
+        LazySample lazySample() const;
+        RenderCache& renderCache() const;
+        std::string_view timeText(char (&buffer)[Timestamp::MaxLength]) const;
+        std::string renderText() const;
+        std::string renderJson() const;
+        void appendLazyMessage(std::string& out) const;
 
     public:
         LogMessage()  = delete;
@@ -18,13 +105,68 @@ class LogMessage {
                    const std::string& time,
                    const std::string& message);
 
-        LogMessage(const LogMessage& other) = default;
-        LogMessage & operator =(const LogMessage& other) = default;
-        
-        LogMessage(LogMessage&& other) = default;
-        LogMessage & operator =(LogMessage&& other) = default;
-        
-        std::string ToString();
-        
-        ~LogMessage() = default;
-};
\ No newline at end of file
+        /**
+         * @brief Typed constructor for hot paths: ids are interned once by the caller
+         */
+        LogMessage(StringInterner::Id appId,
+                   StringInterner::Id contextId,
+                   SeverityLvl_enum severity,
+                   int64_t timestampNs,
+                   std::string_view message);
+
+        LogMessage(StringInterner::Id appId,
+                   TelemetrySrc_enum context,
+                   SeverityLvl_enum severity,
+                   int64_t timestampNs,
+                   std::string_view message);
+
+        /**
+         * @brief Lazy sample: no text is built until a sink asks for it
+         */
+        LogMessage(StringInterner::Id appId,
+                   StringInterner::Id contextId,
+                   SeverityLvl_enum severity,
+                   int64_t timestampNs,
+                   float value,
+                   const SampleFormat& format);
+
+        LogMessage(StringInterner::Id appId,
+                   TelemetrySrc_enum context,
+                   SeverityLvl_enum severity,
+                   int64_t timestampNs,
+                   float value,
+                   const SampleFormat& format);
+
+        LogMessage(const LogMessage& other);
+        LogMessage & operator =(const LogMessage& other);
+
+        LogMessage(LogMessage&& other) noexcept;
+        LogMessage & operator =(LogMessage&& other) noexcept;
+
+        /**
+         * @brief The whole line in 'format', without a trailing newline;
+         * valid as long as the message
+         */
+        const std::string& Render(LogFormat_enum format = LogFormat_enum::TEXT) const;
+        std::string ToString() const;
+
+        const std::string& GetAppName() const;
+        const std::string& GetContext() const;
+        const std::string& GetSeverity() const;
+        SeverityLvl_enum GetSeverityLevel() const;
+        void SetSeverityLevel(SeverityLvl_enum level);     // Drops a custom label and any rendered lines
+        int64_t GetTimestampNs() const;
+        std::string GetTime() const;
+        std::string_view GetMessage() const;
+        std::optional<float> GetValue() const;      // Lazy messages only
+
+        // Messages whose text was cut at 65535 bytes, since the process started
+        static uint64_t truncatedCount();
+
+        static StringInterner::Id contextIdOf(TelemetrySrc_enum context);
+        static const std::string& severityName(SeverityLvl_enum severity);
+
+        ~LogMessage();
+};
+
+static_assert(sizeof(LogMessage) < 64, "LogMessage should stay under one cache line");
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * @brief Process-wide table mapping short, recurring strings to 16-bit ids
+ *
+ * Used by LogMessage for app names, contexts and severity labels, so a
+ * queued message carries a uint16_t instead of a std::string.
+ *
+ * - intern() takes a mutex and is meant for setup paths (formatter
+ *   construction) or the rare odd string; hot paths keep the id.
+ * - lookup() is lock-free: entries are never removed, and each slot is
+ *   published with a release store once its string is complete.
+ *
+ * Id 0 is always the empty string. When all MaxStrings ids are used,
+ * intern() reports it once and returns the id of "?".
+ */
+class StringInterner {
+    public:
+        using Id = uint16_t;
+        static constexpr size_t MaxStrings = 4096;
+
+        static StringInterner& instance();
+
+        Id intern(std::string_view text);
+        const std::string& lookup(Id id) const;
+
+        StringInterner(const StringInterner&) = delete;
+        StringInterner& operator=(const StringInterner&) = delete;
+
+    private:
+        StringInterner();
+
+        mutable std::mutex mx;
+        std::unordered_map<std::string_view, Id> ids;       // Keys point into 'slots'
+        std::array<std::atomic<const std::string*>, MaxStrings> slots;
+        std::array<std::unique_ptr<const std::string>, MaxStrings> owned;
+        size_t count;
+        Id overflowId;
+        bool overflowReported;
+
+        Id insertLocked(std::string_view text);
+};
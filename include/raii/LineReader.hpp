@@ -0,0 +1,66 @@
+# pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <sys/types.h>
+
+/**
+ * @brief Newline-delimited reads from a file descriptor through one reusable buffer
+ *
+ * One read() fills the buffer with as many queued lines as fit;
+ * memchr finds each '\n' and the line is handed out as a string_view
+ * into the buffer (no copy, newline not included). Following lines come
+ * out of the buffer without another syscall, until it runs dry.
+ *
+ * Edge cases follow the old one-byte-per-read() loops:
+ *   - end of file with a partial line buffered: the partial line is returned
+ *   - a line longer than the buffer is returned in buffer-sized pieces
+ * A non-blocking descriptor with no complete line returns false and keeps
+ * the partial line for the next call.
+ *
+ * A line view stays valid until the next call on the reader. The reader
+ * does not own the descriptor.
+ */
+class LineReader {
+    public:
+        static constexpr size_t MinCapacity = 4 * 1024;
+        static constexpr size_t MaxCapacity = 64 * 1024;
+        static constexpr size_t DefaultCapacity = 16 * 1024;
+
+        // Capacity is clamped to [MinCapacity, MaxCapacity]
+        explicit LineReader(size_t capacity = DefaultCapacity);
+        LineReader(const LineReader& other) = delete;
+        LineReader& operator=(const LineReader& other) = delete;
+        LineReader(LineReader&& other) = default;
+        LineReader& operator=(LineReader&& other) = default;
+        ~LineReader() = default;
+
+        /**
+         * @brief Next line, calling read() only when no complete line is buffered
+         * @return false on end of file, error, or (non-blocking) no complete line yet
+         */
+        bool readLine(int fd, std::string_view& line);
+
+        // End of file, or a read error other than would-block: nothing more will come
+        bool atEnd() const { return ended; }
+
+        size_t buffered() const { return end - begin; }
+        size_t capacity() const { return size; }
+        uint64_t readCalls() const { return reads; }
+
+    private:
+        // One read() into the free space (retried on EINTR); bytes read, 0 at end, -1 on error
+        ssize_t fill(int fd);
+        void compact();
+        bool bufferedLine(std::string_view& line);      // Next complete line buffered; no read()
+        bool oversizedLine(std::string_view& line);     // Full buffer, no newline: take it all
+
+        std::unique_ptr<char[]> buffer;
+        size_t size;
+        size_t begin = 0;               // First byte not handed out yet
+        size_t end = 0;                 // One past the last byte read
+        uint64_t reads = 0;
+        bool ended = false;
+};
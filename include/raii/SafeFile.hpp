@@ -1,10 +1,13 @@
 # pragma once 
 
 #include <string>
+#include <string_view>
+#include "raii/LineReader.hpp"
 
 class SafeFile{
     private :
         int fd;
+        LineReader Reader;
     public :
         SafeFile() = delete;
         SafeFile(std::string &RefFilePath);
@@ -15,7 +18,12 @@ class SafeFile{
         SafeFile& operator=(SafeFile&& other) = default;
 
         bool IsOpen();
+        int Fd() const;
         std::string Read();
+        // No copy: the line is valid until the next read
+        bool ReadLine(std::string_view &line);
+        // End of file or a read error, and every buffered line handed out
+        bool AtEnd() const;
 
         ~SafeFile();
 };
\ No newline at end of file
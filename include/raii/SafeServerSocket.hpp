@@ -0,0 +1,26 @@
+# pragma once 
+
+#include <string>
+
+// Listening AF_UNIX stream socket; the path is unlinked again on destruction
+class SafeServerSocket{
+    private :
+        int SocketFd;
+        std::string Path;
+    public :
+        SafeServerSocket() = delete;
+        // A stale socket file at the path (left by a crash) is replaced
+        SafeServerSocket(std::string &RefFilePath, int Backlog = 128);
+        SafeServerSocket(const SafeServerSocket& other) = delete;
+        SafeServerSocket(SafeServerSocket&& other) = delete;
+
+        SafeServerSocket& operator=(const SafeServerSocket& other) = delete;
+        SafeServerSocket& operator=(SafeServerSocket&& other) = delete;
+
+        bool IsOpen();
+        int Fd() const;
+        // Next pending connection, non-blocking; -1 when none is waiting
+        int Accept();
+
+        ~SafeServerSocket();
+};
@@ -1,21 +1,29 @@
 # pragma once 
 
 #include <string>
+#include <string_view>
+#include "raii/LineReader.hpp"
 
 class SafeSocket{
     private :
         int SocketFd;
+        LineReader Reader;
     public :
         SafeSocket() = delete;
-        SafeSocket(std::string &RefFilePath);
+        // NonBlocking: connect() and reads never wait (a read with no line returns false)
+        SafeSocket(std::string &RefFilePath, bool NonBlocking = false);
         SafeSocket(SafeSocket&& other) = default;
         SafeSocket(const SafeSocket& other) = delete;
 
         SafeSocket& operator=(const SafeSocket& other) = delete;
         SafeSocket& operator=(SafeSocket&& other) = default;
 
+        // False once the peer has closed (or the socket failed) and every line was read
         bool IsOpen();
+        int Fd() const;
         std::string Read();
+        // No copy: the line is valid until the next read
+        bool ReadLine(std::string_view &line);
 
         ~SafeSocket();
 };
\ No newline at end of file
@@ -1,10 +1,14 @@
 #pragma once 
 
+#include "enums/LogFormat.hpp"
 #include "sinks/ILogSink.hpp"
 
 class ConsoleSinkImpl : public ILogSink{
+    private:
+        LogFormat_enum Format;
+
     public:
-        ConsoleSinkImpl() = default;
+        explicit ConsoleSinkImpl(LogFormat_enum format = LogFormat_enum::TEXT) : Format(format) {}
         ConsoleSinkImpl(const ConsoleSinkImpl & other) = delete;
         ConsoleSinkImpl(ConsoleSinkImpl && other) = default;
 
@@ -12,6 +16,7 @@ class ConsoleSinkImpl : public ILogSink{
         ConsoleSinkImpl & operator =(ConsoleSinkImpl && other) = default;
 
         virtual void write(const LogMessage &log_message);
+        virtual void writeBatch(const LogMessage *log_messages, size_t count) override;
 
         virtual ~ConsoleSinkImpl() override = default;
 };
\ No newline at end of file
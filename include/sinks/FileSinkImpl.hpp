@@ -2,25 +2,69 @@
 
 #pragma once
 
+#include <chrono>
+#include <string>
+#include <sys/types.h>
+#include "enums/LogFormat.hpp"
 #include "logger/LogMessage.hpp"
 #include "sinks/ILogSink.hpp"
 
 
+/**
+ * @brief Appends log lines to a file through a persistent fd
+ *
+ * Lines are collected in a userspace buffer and written with one write()
+ * when the buffer reaches FlushBytes, when a CRITICAL line is added, when
+ * FlushInterval has elapsed since the last flush, on flush() and on
+ * destruction. The interval is checked on every write, and LogManager
+ * also calls flush() every FlushInterval (flushInterval()), so a quiet
+ * period does not leave lines in the buffer.
+ * Before each flush the path is stat()ed: if the file was rotated away
+ * (different inode) or deleted, it is reopened.
+ *
+ * Not thread-safe on its own: LogManager runs each sink on its own Strand,
+ * so write()/writeBatch()/flush() are never called concurrently.
+ */
 class FileSinkImpl : public ILogSink{
     private:
         std::string FilePath;
+        LogFormat_enum Format;
+        int fd;
+        dev_t fileDev;
+        ino_t fileIno;
+
+        std::string pending;                // Lines not written yet
+        size_t FlushBytes;
+        std::chrono::milliseconds FlushInterval;
+        std::chrono::steady_clock::time_point lastFlush;
+
+        bool openFile();
+        void reopenIfRotated();
+        bool appendLine(const LogMessage &log_message);    // True for a CRITICAL line
+        void flushIfDue();
+        void flushPending();
+
     public:
+        static constexpr size_t DefaultFlushBytes = 64 * 1024;
+        static constexpr std::chrono::milliseconds DefaultFlushInterval{1000};
+
         FileSinkImpl() = delete;
-        FileSinkImpl(std::string &RefFilePath);
+        FileSinkImpl(std::string &RefFilePath,
+                     size_t flushBytes = DefaultFlushBytes,
+                     std::chrono::milliseconds flushInterval = DefaultFlushInterval,
+                     LogFormat_enum format = LogFormat_enum::TEXT);
         
         FileSinkImpl(const FileSinkImpl& other) = delete;
         FileSinkImpl(FileSinkImpl &&other) = delete;
 
         FileSinkImpl & operator =(const FileSinkImpl& other) = delete;
-        FileSinkImpl & operator =(FileSinkImpl && other) = default;
+        FileSinkImpl & operator =(FileSinkImpl && other) = delete;
 
         virtual void write(const LogMessage &log_message);
+        virtual void writeBatch(const LogMessage *log_messages, size_t count) override;
+        virtual void flush() override;
+        virtual std::chrono::milliseconds flushInterval() const override;
 
-        virtual ~FileSinkImpl() override = default;
+        virtual ~FileSinkImpl() override;
 };
 
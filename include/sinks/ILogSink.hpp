@@ -1,8 +1,28 @@
 #pragma once
+#include <chrono>
+#include <cstddef>
 #include "logger/LogMessage.hpp"
 
 class ILogSink{
 public:
     virtual void write(const LogMessage &log_message) = 0;
+
+    // Writes 'count' consecutive messages. Default: one write() per message;
+    // sinks that can emit a whole batch with one syscall override this.
+    virtual void writeBatch(const LogMessage *log_messages, size_t count){
+        for (size_t i = 0; i < count; ++i) {
+            write(log_messages[i]);
+        }
+    }
+
+    // Pushes anything the sink buffers internally to its destination
+    virtual void flush(){}
+
+    // How often LogManager calls flush() on its own, so buffered lines do
+    // not wait for the next write (0: never)
+    virtual std::chrono::milliseconds flushInterval() const{
+        return std::chrono::milliseconds(0);
+    }
+
     virtual ~ILogSink() = default;
-};
\ No newline at end of file
+};
@@ -5,12 +5,14 @@
 #pragma once 
 
 #include <string>
+#include "enums/LogFormat.hpp"
 #include "enums/SinksType.hpp"
 
 
 struct SinkConfig {
     SinkType type;
     std::string filePath;      // Only used for File sink
+    LogFormat_enum format = LogFormat_enum::TEXT;
     
     SinkConfig() = default;
     // Static factory methods for easy config creation
@@ -20,6 +20,7 @@ class FileTelemetrySourceImpl : public ITelemetrySource{
 
         virtual bool openSource();
         virtual bool readSource(std::string &RefRead);
+        virtual int sourceFd() const;
 
         virtual~FileTelemetrySourceImpl() = default;
 
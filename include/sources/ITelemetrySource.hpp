@@ -6,6 +6,10 @@ class ITelemetrySource{
     public:
         virtual bool openSource() = 0;
         virtual bool readSource(std::string &RefRead) = 0;
+        // Descriptor to wait on for data; -1 = none, the source is polled every rateMs
+        virtual int sourceFd() const { return -1; }
+        // Drops the connection/handle; openSource() opens it again
+        virtual void closeSource() {}
         virtual ~ITelemetrySource() = default;
 
 };
\ No newline at end of file
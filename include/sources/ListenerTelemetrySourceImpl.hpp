@@ -0,0 +1,74 @@
+#pragma once 
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "sources/ITelemetrySource.hpp"
+#include "raii/LineReader.hpp"
+#include "raii/SafeServerSocket.hpp"
+
+/**
+ * @brief Server-mode socket source: many producers push lines to one AF_UNIX path
+ *
+ * Connections are multiplexed with a private epoll set; sourceFd() is
+ * that epoll descriptor, so the app's reactor wakes when any producer
+ * (or a new connection) is ready. readSource() hands out one line per
+ * ready connection in turn, so a flooding producer cannot starve the rest.
+ *
+ * A producer may open with "@TAG": its unlabeled lines are then handed
+ * out as "TAG: <line>", as if it had labeled them itself.
+ */
+class ListenerTelemetrySourceImpl : public ITelemetrySource{
+    private :
+        struct Connection {
+            int Fd;
+            LineReader Reader;
+            std::string Tag;            // From "@TAG"
+            bool Queued = false;        // In Ready
+        };
+
+        static constexpr size_t MinRound = 64;
+
+        std::string FilePath;
+        size_t MaxConnections;
+        std::unique_ptr<SafeServerSocket> _serverPtr;
+        int EpollFd = -1;
+        std::unordered_map<int, Connection> Connections;
+        std::deque<Connection*> Ready;
+        size_t UntilPoll = 0;           // Lines left in this round before epoll is asked again
+
+        uint64_t Accepted = 0;
+        uint64_t Rejected = 0;          // Over MaxConnections
+        uint64_t Disconnected = 0;
+
+        bool pollReady();
+        void acceptPending();
+        void closeConnection(int Fd);
+
+    public :
+        ListenerTelemetrySourceImpl() = delete;
+        ListenerTelemetrySourceImpl(std::string &RefFilePath, size_t MaxConnections = 256);
+        ListenerTelemetrySourceImpl(const ListenerTelemetrySourceImpl& other) = delete;
+        ListenerTelemetrySourceImpl &operator=(const ListenerTelemetrySourceImpl & other) = delete;
+
+        // Binds and listens (replacing a stale socket file)
+        virtual bool openSource();
+        // True with an empty line when no producer has a complete line
+        virtual bool readSource(std::string &RefRead);
+        virtual int sourceFd() const;
+        virtual void closeSource();
+
+        size_t connectionCount() const { return Connections.size(); }
+        uint64_t acceptedCount() const { return Accepted; }
+        uint64_t rejectedCount() const { return Rejected; }
+        uint64_t disconnectedCount() const { return Disconnected; }
+
+        // "TEMP: 71.5" -> "TEMP"; empty when the line has no label (SampleParser's rule)
+        static std::string_view labelOf(std::string_view line);
+
+        virtual ~ListenerTelemetrySourceImpl();
+};
@@ -17,8 +17,12 @@ class SocketTelemetrySourceImpl : public ITelemetrySource{
         SocketTelemetrySourceImpl &operator=(const SocketTelemetrySourceImpl & other) = delete;
         SocketTelemetrySourceImpl &operator=(SocketTelemetrySourceImpl && other) = default;
 
+        // Non-blocking connect: fails at once if nobody is listening (retry later)
         virtual bool openSource();
+        // True with an empty line when nothing is queued; false once the peer has closed
         virtual bool readSource(std::string &RefRead);
+        virtual int sourceFd() const;
+        virtual void closeSource();
 
         virtual ~SocketTelemetrySourceImpl() = default;
 };
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+
+/**
+ * @brief Exponential backoff with jitter, for reconnect attempts
+ *
+ * next() doubles the delay from 'initial' up to 'maximum'. Each delay is
+ * drawn from [d/2, d], so sources that lost the same server do not all
+ * retry in the same tick when it comes back. reset() after a success.
+ */
+class Backoff {
+    public:
+        Backoff(std::chrono::milliseconds initial, std::chrono::milliseconds maximum, uint32_t seed = 1)
+            : initialDelay(std::max(initial, std::chrono::milliseconds(1)))
+            , maximumDelay(std::max(maximum, initialDelay))
+            , delay(initialDelay)
+            , rng(seed) {}
+
+        std::chrono::milliseconds next() {
+            const int64_t half = delay.count() / 2;
+            const std::chrono::milliseconds chosen(delay.count() - static_cast<int64_t>(rng() % static_cast<uint32_t>(half + 1)));
+            delay = std::min(delay * 2, maximumDelay);
+            ++failures;
+            return chosen;
+        }
+
+        void reset() {
+            delay = initialDelay;
+            failures = 0;
+        }
+
+        // next() calls since the last reset()
+        uint32_t attempts() const { return failures; }
+
+    private:
+        std::chrono::milliseconds initialDelay;
+        std::chrono::milliseconds maximumDelay;
+        std::chrono::milliseconds delay;
+        uint32_t failures = 0;
+        std::minstd_rand rng;
+};
@@ -0,0 +1,289 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Bounded lock-free multi-producer / multi-consumer ring buffer
+ *
+ * Same try_push()/try_pop() API as RingBuffer, usable from any number of
+ * threads on both sides. Based on per-slot sequence numbers:
+ *
+ *  - Every slot carries an atomic sequence. For the slot at position
+ *    'pos', sequence == pos means "free, waiting for the producer that
+ *    claims pos", sequence == pos + 1 means "filled, waiting for the
+ *    consumer that claims pos".
+ *  - Producers claim a position with one CAS on enqueuePos_, consumers
+ *    with one CAS on dequeuePos_. The two counters live on separate
+ *    cache lines so producers and consumers do not contend with each other.
+ *  - After reading, the consumer sets sequence = pos + capacity, which is
+ *    exactly the value the producer of the next lap will look for.
+ *
+ * Capacity is rounded up to a power of two (minimum 2).
+ *
+ * @tparam T The type of elements stored in the buffer
+ */
+template <typename T>
+class MpmcRingBuffer {
+private:
+    // ============================================
+    // Member Variables
+    // ============================================
+
+    static constexpr size_t CacheLineSize = 64;
+
+    struct Cell {
+        std::atomic<size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    // Read-only after construction
+    alignas(CacheLineSize) std::unique_ptr<Cell[]> cells_;
+    size_t capacity_;
+    size_t mask_;
+
+    alignas(CacheLineSize) std::atomic<size_t> enqueuePos_;   // Next position to claim for writing
+    alignas(CacheLineSize) std::atomic<size_t> dequeuePos_;   // Next position to claim for reading
+
+    static size_t roundUpPow2(size_t value) {
+        size_t result = 2;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    static T* valueOf(Cell& cell) {
+        return std::launder(reinterpret_cast<T*>(cell.storage));
+    }
+
+public:
+    // ============================================
+    // Constructors & Destructor
+    // ============================================
+
+    MpmcRingBuffer() = delete;
+
+    /**
+     * @brief Constructs a MpmcRingBuffer
+     *
+     * @param cap Minimum number of elements; rounded up to a power of two
+     * @throws std::invalid_argument if cap is 0
+     */
+    explicit MpmcRingBuffer(size_t cap)
+        : cells_(nullptr)
+        , capacity_(roundUpPow2(cap))
+        , mask_(capacity_ - 1)
+        , enqueuePos_(0)
+        , dequeuePos_(0)
+    {
+        if (cap == 0) {
+            throw std::invalid_argument("MpmcRingBuffer capacity must be > 0");
+        }
+        cells_.reset(new Cell[capacity_]);
+        for (size_t i = 0; i < capacity_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcRingBuffer(const MpmcRingBuffer&) = delete;
+    MpmcRingBuffer& operator=(const MpmcRingBuffer&) = delete;
+    MpmcRingBuffer(MpmcRingBuffer&&) = delete;
+    MpmcRingBuffer& operator=(MpmcRingBuffer&&) = delete;
+
+    /**
+     * @brief Destroys any elements still in the buffer
+     */
+    ~MpmcRingBuffer() {
+        clear();
+    }
+
+    // ============================================
+    // Core Functions
+    // ============================================
+
+    /**
+     * @brief Attempts to push an item (any thread)
+     *
+     * @return false if buffer is full (item not pushed)
+     */
+    template <typename U=T>
+    bool try_push(U&& value) {
+        Cell* cell;
+        size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+
+        while (true) {
+            cell = &cells_[pos & mask_];
+            const size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+            if (diff == 0) {
+                // Slot is free for this lap: try to claim it
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;   // Slot still holds last lap's element: full
+            } else {
+                pos = enqueuePos_.load(std::memory_order_relaxed);   // Lost the race, retry
+            }
+        }
+
+        new (cell->storage) T(std::forward<U>(value));
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Attempts to pop an item (any thread)
+     *
+     * @return std::optional<T> containing the item, or nullopt if empty
+     */
+    std::optional<T> try_pop() {
+        Cell* cell;
+        size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+
+        while (true) {
+            cell = &cells_[pos & mask_];
+            const size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+
+            if (diff == 0) {
+                // Slot is filled for this lap: try to claim it
+                if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return std::nullopt;   // Producer has not published this slot yet: empty
+            } else {
+                pos = dequeuePos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        T* slot = valueOf(*cell);
+        std::optional<T> value(std::move(*slot));
+        slot->~T();
+
+        // Free the slot for the producer of the next lap
+        cell->sequence.store(pos + capacity_, std::memory_order_release);
+        return value;
+    }
+
+    /**
+     * @brief Pops the oldest item only if pred(item) is true
+     *
+     * The item is inspected before it is claimed, so the caller must be the
+     * only consumer while this runs (serialize it with the other consumers).
+     * Producers may keep pushing.
+     *
+     * @return std::optional<T> containing the item, or nullopt if empty or
+     *         pred rejected the oldest item (which stays in place)
+     */
+    template <typename Pred>
+    std::optional<T> try_pop_if(Pred pred) {
+        const size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        Cell& cell = cells_[pos & mask_];
+        if (cell.sequence.load(std::memory_order_acquire) != pos + 1 ||
+            !pred(static_cast<const T&>(*valueOf(cell)))) {
+            return std::nullopt;
+        }
+        dequeuePos_.store(pos + 1, std::memory_order_relaxed);
+
+        T* slot = valueOf(cell);
+        std::optional<T> value(std::move(*slot));
+        slot->~T();
+        cell.sequence.store(pos + capacity_, std::memory_order_release);
+        return value;
+    }
+
+    /**
+     * @brief Pushes up to 'count' items (any thread)
+     *
+     * Slots are claimed one CAS at a time: another producer may interleave
+     * its items, and a batch is not guaranteed to land contiguously.
+     *
+     * @return Number of items actually pushed (stops when buffer is full)
+     */
+    template <typename InputIt>
+    size_t try_push_n(InputIt first, size_t count) {
+        size_t pushed = 0;
+        while (pushed < count && try_push(*first)) {
+            ++first;
+            ++pushed;
+        }
+        return pushed;
+    }
+
+    /**
+     * @brief Moves up to 'max' items to the back of 'out' (any thread)
+     *
+     * @return Number of items drained
+     */
+    size_t drain_into(std::vector<T>& out, size_t max) {
+        size_t drained = 0;
+        while (drained < max) {
+            std::optional<T> value = try_pop();
+            if (!value.has_value()) {
+                break;
+            }
+            out.push_back(std::move(*value));
+            ++drained;
+        }
+        return drained;
+    }
+
+    /**
+     * @brief Discards all elements currently visible (any thread)
+     */
+    void clear() {
+        while (try_pop().has_value()) {
+        }
+    }
+
+    // ============================================
+    // Getters
+    // ============================================
+
+    /**
+     * @brief Snapshot of the number of claimed-but-not-consumed slots
+     */
+    size_t size() const {
+        const size_t dequeued = dequeuePos_.load(std::memory_order_acquire);
+        const size_t enqueued = enqueuePos_.load(std::memory_order_acquire);
+        const size_t count = enqueued - dequeued;
+        return (count > capacity_) ? capacity_ : count;
+    }
+
+    /**
+     * @brief Positions ever claimed by producers (every claim completes)
+     */
+    size_t push_count() const {
+        return enqueuePos_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Positions ever claimed by consumers (FIFO order)
+     */
+    size_t pop_count() const {
+        return dequeuePos_.load(std::memory_order_acquire);
+    }
+
+    size_t capacity() const {
+        return capacity_;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    bool full() const {
+        return size() >= capacity_;
+    }
+};
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Single-threaded event loop on epoll (Linux)
+ *
+ * Descriptors are watched for readiness, timers are timerfds in the
+ * same epoll set, and stop() writes an eventfd: run() sleeps in
+ * epoll_wait with no CPU use until data, a deadline or stop() arrives,
+ * and the handler runs right away instead of at the next poll.
+ *
+ * Handlers run on the thread that calls run(). They may watch/unwatch
+ * and add/remove timers, including their own.
+ */
+class Reactor {
+    public:
+        // Readiness: the epoll events (EPOLLIN, EPOLLHUP, ...). Timers: expirations since the last call
+        using Handler = std::function<void(uint32_t)>;
+        using TimerId = int;
+
+        static constexpr int MaxEvents = 64;        // Per epoll_wait
+
+        Reactor();
+        Reactor(const Reactor& other) = delete;
+        Reactor& operator=(const Reactor& other) = delete;
+        ~Reactor();
+
+        bool isValid() const { return epollFd >= 0 && wakeFd >= 0; }
+
+        /**
+         * @brief Calls handler when fd is ready for 'events'; fd is made non-blocking
+         * @return false if fd cannot be polled (e.g. a regular file: EPERM)
+         */
+        bool watch(int fd, uint32_t events, Handler handler);
+        void unwatch(int fd);
+
+        /**
+         * @brief Periodic timer, first expiry one period from now
+         * @return Id for removeTimer(), -1 on failure
+         */
+        TimerId addTimer(std::chrono::milliseconds period, Handler handler);
+
+        // Disarmed until arm()
+        TimerId addTimer(Handler handler);
+
+        /**
+         * @brief (Re)starts a timer: first expiry after delay (0: at once), then every period (0: once)
+         */
+        bool arm(TimerId id, std::chrono::milliseconds delay,
+                 std::chrono::milliseconds period = std::chrono::milliseconds(0));
+        void removeTimer(TimerId id);
+
+        /**
+         * @brief Runs fn after the current batch of events, before sleeping again
+         *
+         * For work that epoll will not report, e.g. lines already read into a
+         * buffer when a handler stopped early. Loop thread only; dropped when
+         * run() returns.
+         */
+        void defer(std::function<void()> fn);
+
+        /**
+         * @brief Dispatches until stop(); a stop() that came before run() returns at once
+         */
+        void run();
+
+        /**
+         * @brief One epoll_wait (timeoutMs -1: until something happens)
+         * @return Handlers called
+         */
+        size_t runOnce(int timeoutMs);
+
+        // Any thread, and async-signal-safe (a write to an eventfd)
+        void stop();
+
+    private:
+        struct Entry {
+            Handler handler;
+            bool timer;
+        };
+
+        void remove(int fd);
+
+        int epollFd;
+        int wakeFd;
+        std::atomic<bool> stopRequested{false};
+        std::unordered_map<int, std::shared_ptr<Entry>> entries;
+        std::vector<std::function<void()>> deferred;
+};
@@ -27,6 +27,7 @@ private:
     size_t tail_;                           // Index where next element will be read (oldest element)
     size_t count_;                          // Current number of elements in buffer
     size_t capacity_;                       // Maximum number of elements buffer can hold
+    size_t pushed_;                         // Elements ever pushed (never wraps back)
 
     mutable std::mutex mutex_;              // Mutex for thread-safety
                                             // 'mutable' allows locking in const methods
@@ -58,6 +59,7 @@ public:
         , tail_(0)          // Start reading at index 0
         , count_(0)         // Buffer starts empty
         , capacity_(cap)    // Store capacity
+        , pushed_(0)
     {
         if (capacity_ == 0) {
             throw std::invalid_argument("RingBuffer capacity must be > 0");
@@ -131,6 +133,7 @@ public:
 
         // Increment element count
         count_++;
+        pushed_++;
 
         return true;    // Successfully pushed
     }
@@ -178,6 +181,75 @@ public:
         return value;   // Return the popped value (wrapped in optional)
     }
 
+    /**
+     * @brief Pops the oldest item only if pred(item) is true
+     * 
+     * @return std::optional<T> containing the item, or nullopt if the buffer
+     *         is empty or pred rejected the oldest item (which stays in place)
+     * 
+     * Thread-safe: Locks mutex during operation.
+     */
+    template <typename Pred>
+    std::optional<T> try_pop_if(Pred pred) {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (count_ == 0 || !pred(static_cast<const T&>(*buffer_[tail_]))) {
+            return std::nullopt;
+        }
+        T value = std::move(*buffer_[tail_]);
+        buffer_[tail_] = std::nullopt;
+        tail_ = (tail_ + 1) % capacity_;
+        count_--;
+        return value;
+    }
+
+    /**
+     * @brief Pushes up to 'count' items under a single lock
+     * 
+     * @param first Iterator to the first item (use std::make_move_iterator to move)
+     * @param count Number of items available at 'first'
+     * @return Number of items actually pushed (stops when buffer is full)
+     * 
+     * Thread-safe: Locks mutex ONCE for the whole batch.
+     */
+    template <typename InputIt>
+    size_t try_push_n(InputIt first, size_t count) {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        size_t pushed = 0;
+        while (pushed < count && count_ < capacity_) {
+            buffer_[head_] = *first;
+            ++first;
+            head_ = (head_ + 1) % capacity_;
+            count_++;
+            pushed++;
+        }
+        pushed_ += pushed;
+        return pushed;
+    }
+
+    /**
+     * @brief Moves up to 'max' items (oldest first) to the back of 'out'
+     * 
+     * @return Number of items drained
+     * 
+     * Thread-safe: Locks mutex ONCE for the whole batch.
+     * 'out' is appended to, not cleared, so callers can reuse its capacity.
+     */
+    size_t drain_into(std::vector<T>& out, size_t max) {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        size_t drained = 0;
+        while (drained < max && count_ > 0) {
+            out.push_back(std::move(*buffer_[tail_]));
+            buffer_[tail_] = std::nullopt;
+            tail_ = (tail_ + 1) % capacity_;
+            count_--;
+            drained++;
+        }
+        return drained;
+    }
+
     /**
      * @brief Clears all elements from the buffer
      * 
@@ -210,6 +282,28 @@ public:
         return count_; 
     }
 
+    /**
+     * @brief Total elements ever pushed
+     * 
+     * Thread-safe: Locks mutex to ensure consistent read.
+     */
+    size_t push_count() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return pushed_;
+    }
+
+    /**
+     * @brief Total elements that ever left the buffer (popped, drained or cleared)
+     * 
+     * Thread-safe: Locks mutex to ensure consistent read.
+     * Elements leave in FIFO order, so every element whose push made
+     * push_count() reach N has left once pop_count() >= N.
+     */
+    size_t pop_count() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return pushed_ - count_;
+    }
+
     /**
      * @brief Returns maximum capacity of buffer
      * 
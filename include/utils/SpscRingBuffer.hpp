@@ -0,0 +1,291 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Lock-free single-producer / single-consumer ring buffer
+ *
+ * Same try_push()/try_pop() API as RingBuffer, but without a mutex:
+ * exactly ONE thread may push and exactly ONE (other) thread may pop.
+ *
+ * Design:
+ *  - head_ (written by producer) and tail_ (written by consumer) are
+ *    monotonically increasing counters living on separate cache lines,
+ *    so the two threads never invalidate each other's line on every op.
+ *  - Each side keeps a cached copy of the other side's index and only
+ *    re-reads the shared atomic when the cached value says full/empty.
+ *  - Capacity is rounded up to a power of two, so slot = index & mask_.
+ *  - Slots are raw aligned storage: T is constructed on push and
+ *    destroyed on pop (no std::optional<T> per slot).
+ *
+ * Thread-Safety: try_push() is producer-only, try_pop()/clear() are
+ * consumer-only. size()/empty()/full() may be called from either side
+ * and return a snapshot.
+ *
+ * @tparam T The type of elements stored in the buffer
+ */
+template <typename T>
+class SpscRingBuffer {
+private:
+    // ============================================
+    // Member Variables
+    // ============================================
+
+    static constexpr size_t CacheLineSize = 64;
+
+    struct Slot {
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    // Read-only after construction (shared by both sides)
+    alignas(CacheLineSize) std::unique_ptr<Slot[]> slots_;
+    size_t capacity_;                       // Always a power of two
+    size_t mask_;                           // capacity_ - 1
+
+    // Producer side
+    alignas(CacheLineSize) std::atomic<size_t> head_;   // Next index to write
+    size_t cachedTail_;                                 // Producer's view of tail_
+
+    // Consumer side
+    alignas(CacheLineSize) std::atomic<size_t> tail_;   // Next index to read
+    size_t cachedHead_;                                 // Consumer's view of head_
+
+    static size_t roundUpPow2(size_t value) {
+        size_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    T* slotAt(size_t index) {
+        return std::launder(reinterpret_cast<T*>(slots_[index & mask_].storage));
+    }
+
+public:
+    // ============================================
+    // Constructors & Destructor
+    // ============================================
+
+    SpscRingBuffer() = delete;
+
+    /**
+     * @brief Constructs a SpscRingBuffer
+     *
+     * @param cap Minimum number of elements; rounded up to a power of two
+     * @throws std::invalid_argument if cap is 0
+     */
+    explicit SpscRingBuffer(size_t cap)
+        : slots_(nullptr)
+        , capacity_(roundUpPow2(cap))
+        , mask_(capacity_ - 1)
+        , head_(0)
+        , cachedTail_(0)
+        , tail_(0)
+        , cachedHead_(0)
+    {
+        if (cap == 0) {
+            throw std::invalid_argument("SpscRingBuffer capacity must be > 0");
+        }
+        slots_.reset(new Slot[capacity_]);
+    }
+
+    /**
+     * @brief Copy and move are DELETED
+     *
+     * The indices are atomics shared between two threads; relocating
+     * the buffer while either side runs is never safe.
+     */
+    SpscRingBuffer(const SpscRingBuffer&) = delete;
+    SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+    SpscRingBuffer(SpscRingBuffer&&) = delete;
+    SpscRingBuffer& operator=(SpscRingBuffer&&) = delete;
+
+    /**
+     * @brief Destroys any elements still in the buffer
+     */
+    ~SpscRingBuffer() {
+        size_t head = head_.load(std::memory_order_relaxed);
+        for (size_t t = tail_.load(std::memory_order_relaxed); t != head; ++t) {
+            slotAt(t)->~T();
+        }
+    }
+
+    // ============================================
+    // Core Functions
+    // ============================================
+
+    /**
+     * @brief Attempts to push an item (PRODUCER thread only)
+     *
+     * @return false if buffer is full (item not pushed)
+     */
+    template <typename U=T>
+    bool try_push(U&& value) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+
+        if (head - cachedTail_ >= capacity_) {
+            // Looks full: refresh our view of the consumer
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+            if (head - cachedTail_ >= capacity_) {
+                return false;
+            }
+        }
+
+        new (slots_[head & mask_].storage) T(std::forward<U>(value));
+
+        // Publish the slot to the consumer
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Attempts to pop an item (CONSUMER thread only)
+     *
+     * @return std::optional<T> containing the item, or nullopt if empty
+     */
+    std::optional<T> try_pop() {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+
+        if (tail == cachedHead_) {
+            // Looks empty: refresh our view of the producer
+            cachedHead_ = head_.load(std::memory_order_acquire);
+            if (tail == cachedHead_) {
+                return std::nullopt;
+            }
+        }
+
+        T* slot = slotAt(tail);
+        std::optional<T> value(std::move(*slot));
+        slot->~T();
+
+        // Hand the slot back to the producer
+        tail_.store(tail + 1, std::memory_order_release);
+        return value;
+    }
+
+    /**
+     * @brief Pops the oldest item only if pred(item) is true (CONSUMER thread only)
+     *
+     * @return std::optional<T> containing the item, or nullopt if empty or
+     *         pred rejected the oldest item (which stays in place)
+     */
+    template <typename Pred>
+    std::optional<T> try_pop_if(Pred pred) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+
+        if (tail == cachedHead_) {
+            cachedHead_ = head_.load(std::memory_order_acquire);
+            if (tail == cachedHead_) {
+                return std::nullopt;
+            }
+        }
+        if (!pred(static_cast<const T&>(*slotAt(tail)))) {
+            return std::nullopt;
+        }
+        return try_pop();
+    }
+
+    /**
+     * @brief Pushes up to 'count' items with ONE publish (PRODUCER thread only)
+     *
+     * @return Number of items actually pushed (stops when buffer is full)
+     */
+    template <typename InputIt>
+    size_t try_push_n(InputIt first, size_t count) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+
+        size_t space = capacity_ - (head - cachedTail_);
+        if (space < count) {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+            space = capacity_ - (head - cachedTail_);
+        }
+
+        const size_t toPush = (count < space) ? count : space;
+        for (size_t i = 0; i < toPush; ++i, ++first) {
+            new (slots_[(head + i) & mask_].storage) T(*first);
+        }
+
+        if (toPush > 0) {
+            head_.store(head + toPush, std::memory_order_release);
+        }
+        return toPush;
+    }
+
+    /**
+     * @brief Moves up to 'max' items to the back of 'out' (CONSUMER thread only)
+     *
+     * Reads head_ once and releases all drained slots with ONE store.
+     *
+     * @return Number of items drained
+     */
+    size_t drain_into(std::vector<T>& out, size_t max) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+
+        cachedHead_ = head_.load(std::memory_order_acquire);
+        const size_t available = cachedHead_ - tail;
+        const size_t toDrain = (max < available) ? max : available;
+
+        for (size_t i = 0; i < toDrain; ++i) {
+            T* slot = slotAt(tail + i);
+            out.push_back(std::move(*slot));
+            slot->~T();
+        }
+
+        if (toDrain > 0) {
+            tail_.store(tail + toDrain, std::memory_order_release);
+        }
+        return toDrain;
+    }
+
+    /**
+     * @brief Discards all elements (CONSUMER thread only)
+     */
+    void clear() {
+        while (try_pop().has_value()) {
+        }
+    }
+
+    // ============================================
+    // Getters
+    // ============================================
+
+    size_t size() const {
+        const size_t tail = tail_.load(std::memory_order_acquire);
+        const size_t head = head_.load(std::memory_order_acquire);
+        return head - tail;
+    }
+
+    /**
+     * @brief Total elements ever pushed
+     */
+    size_t push_count() const {
+        return head_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Total elements that ever left the buffer (FIFO order)
+     */
+    size_t pop_count() const {
+        return tail_.load(std::memory_order_acquire);
+    }
+
+    size_t capacity() const {
+        return capacity_;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    bool full() const {
+        return size() >= capacity_;
+    }
+};
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Move-only, type-erased void() callable with inline storage
+ *
+ * Replaces std::function<void()> in ThreadPool: callables up to InlineSize
+ * bytes (a sink pointer plus a shared_ptr batch, a std::function, ...)
+ * live inside the Task itself, so constructing one does not allocate.
+ * Larger or throwing-move callables fall back to one heap allocation.
+ * Unlike std::function, move-only callables are accepted.
+ */
+class Task {
+    public:
+        static constexpr size_t InlineSize = 48;
+
+    private:
+        struct Ops {
+            void (*invoke)(void* storage);
+            void (*move)(void* dst, void* src);     // Move-construct dst from src, destroy src
+            void (*destroy)(void* storage);
+        };
+
+        template <typename F>
+        static constexpr bool fitsInline =
+            sizeof(F) <= InlineSize &&
+            alignof(F) <= alignof(std::max_align_t) &&
+            std::is_nothrow_move_constructible<F>::value;
+
+        template <typename F>
+        static const Ops* inlineOps() {
+            static const Ops ops{
+                [](void* s) { (*std::launder(static_cast<F*>(s)))(); },
+                [](void* d, void* s) {
+                    F* src = std::launder(static_cast<F*>(s));
+                    new (d) F(std::move(*src));
+                    src->~F();
+                },
+                [](void* s) { std::launder(static_cast<F*>(s))->~F(); }
+            };
+            return &ops;
+        }
+
+        template <typename F>
+        static const Ops* heapOps() {
+            static const Ops ops{
+                [](void* s) { (**static_cast<F**>(s))(); },
+                [](void* d, void* s) { *static_cast<F**>(d) = *static_cast<F**>(s); },
+                [](void* s) { delete *static_cast<F**>(s); }
+            };
+            return &ops;
+        }
+
+        alignas(std::max_align_t) unsigned char storage[InlineSize];
+        const Ops* ops;
+
+    public:
+        Task() noexcept : ops(nullptr) {}
+
+        template <typename F,
+                  typename = std::enable_if_t<!std::is_same<std::decay_t<F>, Task>::value>>
+        Task(F&& f) : ops(nullptr) {
+            emplace(std::forward<F>(f));
+        }
+
+        Task(Task&& other) noexcept : ops(other.ops) {
+            if (ops != nullptr) {
+                ops->move(storage, other.storage);
+                other.ops = nullptr;
+            }
+        }
+
+        Task& operator=(Task&& other) noexcept {
+            if (this != &other) {
+                reset();
+                if (other.ops != nullptr) {
+                    other.ops->move(storage, other.storage);
+                    ops = other.ops;
+                    other.ops = nullptr;
+                }
+            }
+            return *this;
+        }
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        ~Task() {
+            reset();
+        }
+
+        /**
+         * @brief Replaces the stored callable
+         */
+        template <typename F>
+        void emplace(F&& f) {
+            using Fn = std::decay_t<F>;
+            reset();
+            if constexpr (fitsInline<Fn>) {
+                new (storage) Fn(std::forward<F>(f));
+                ops = inlineOps<Fn>();
+            } else {
+                new (storage) Fn*(new Fn(std::forward<F>(f)));
+                ops = heapOps<Fn>();
+            }
+        }
+
+        /**
+         * @brief Destroys the stored callable (and everything it captured)
+         */
+        void reset() noexcept {
+            if (ops != nullptr) {
+                ops->destroy(storage);
+                ops = nullptr;
+            }
+        }
+
+        void operator()() {
+            ops->invoke(storage);
+        }
+
+        explicit operator bool() const noexcept {
+            return ops != nullptr;
+        }
+};
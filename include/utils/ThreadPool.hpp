@@ -1,4 +1,4 @@
-#pragma once 
+#pragma once
 
 
 
@@ -7,20 +7,264 @@
 #include <mutex>
 #include <condition_variable>
 #include <atomic>
-#include <queue>
-#include <functional>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include "utils/MpmcRingBuffer.hpp"
+#include "utils/Task.hpp"
+#include "utils/WorkStealingDeque.hpp"
 
 
+class ThreadPool;
+
+namespace threadpool_detail {
+
+    /**
+     * @brief One queued task; recycled through ThreadPool's node cache
+     *
+     * refs counts the owners: 1 for the pool until the task has run,
+     * +1 for an outstanding Completion. The last owner recycles the node.
+     */
+    struct TaskNode {
+        Task task;
+        TaskNode* next = nullptr;           // Intrusive link (injection queue, Strand)
+        std::atomic<uint32_t> refs{0};
+        std::atomic<bool> done{false};
+    };
+
+    /**
+     * @brief Intrusive FIFO of TaskNodes; not synchronized
+     */
+    struct TaskList {
+        TaskNode* head = nullptr;
+        TaskNode* tail = nullptr;
+
+        bool empty() const { return head == nullptr; }
+
+        void push(TaskNode* node) {
+            node->next = nullptr;
+            if (tail == nullptr) {
+                head = node;
+            } else {
+                tail->next = node;
+            }
+            tail = node;
+        }
+
+        TaskNode* pop() {
+            TaskNode* node = head;
+            if (node != nullptr) {
+                head = node->next;
+                if (head == nullptr) {
+                    tail = nullptr;
+                }
+            }
+            return node;
+        }
+    };
+
+}
+
+
+/**
+ * @brief Completion token returned by ThreadPool/Strand::submit(ThreadPool::track, ...)
+ *
+ * Move-only handle on the submitted task: ready() polls, wait() /
+ * wait_for() block until the task has run. Must not outlive its pool.
+ */
+class Completion {
+    private:
+        ThreadPool* pool;
+        threadpool_detail::TaskNode* node;
+
+        friend class ThreadPool;
+        friend class Strand;
+        Completion(ThreadPool* pool, threadpool_detail::TaskNode* node) : pool(pool), node(node) {}
+        void release();
+
+    public:
+        Completion() : pool(nullptr), node(nullptr) {}
+        Completion(Completion&& other) noexcept : pool(other.pool), node(other.node) {
+            other.node = nullptr;
+        }
+        Completion& operator=(Completion&& other) noexcept;
+        Completion(const Completion&) = delete;
+        Completion& operator=(const Completion&) = delete;
+        ~Completion() { release(); }
+
+        bool valid() const { return node != nullptr; }
+        bool ready() const;
+        void wait() const;
+        bool wait_for(std::chrono::milliseconds timeout) const;
+};
+
+
+/**
+ * @brief Work-stealing thread pool
+ *
+ * Every worker owns a Chase-Lev deque. Tasks submitted FROM a worker
+ * (e.g. a task spawning follow-up work) go to that worker's deque with
+ * no lock; tasks submitted from any other thread go to the shared
+ * injection queue. An idle worker looks in its own deque, then the
+ * injection queue, then steals from the other workers. When there is
+ * nothing to find it spins for SpinRounds attempts and then parks on a
+ * condition variable; submitters only touch that mutex when some worker
+ * is actually parked.
+ *
+ * Tasks are stored as move-only Tasks inside pooled TaskNodes: once the
+ * node cache is warm, submitting a callable of up to Task::InlineSize
+ * bytes does not allocate.
+ *
+ * The destructor runs every task that is still queued, then joins.
+ */
 class ThreadPool {
     private:
-        std::vector<std::thread> workers;
+        using TaskNode = threadpool_detail::TaskNode;
+
+        struct Worker {
+            WorkStealingDeque<TaskNode*> deque;
+            std::thread thread;
+        };
+
+        std::vector<std::unique_ptr<Worker>> workers;
+
+        // Injection queue for submits from outside the pool
+        std::mutex injectMx;
+        threadpool_detail::TaskList injected;
+        std::atomic<size_t> injectedCount;
+
+        // Parking
         std::mutex mx;
         std::condition_variable cv;
+        std::atomic<size_t> sleepers;
         std::atomic<bool> stop;
-        std::queue<std::function<void()>> tasks;
+
+        // Recycled nodes; a miss allocates, a full cache frees
+        MpmcRingBuffer<TaskNode*> freeNodes;
+
+        // Completion::wait() sleeps here; only tracked tasks notify
+        std::mutex completionMx;
+        std::condition_variable completionCv;
+
+        static constexpr size_t SpinRounds = 64;
+        static constexpr size_t NodeCacheSize = 1024;
+
+        void workerLoop(size_t index);
+        TaskNode* findTask(size_t index);
+        TaskNode* popInjected();
+        bool hasQueuedTasks() const;
+        void inject(TaskNode* node);
+        void wakeOne();
+
+        TaskNode* acquireNode();
+        void releaseNode(TaskNode* node);
+        void runNode(TaskNode* node);
+        void schedule(TaskNode* node);
+        void schedulePosted(TaskNode* node);
+
+        template <typename F>
+        TaskNode* makeNode(F&& f, uint32_t refs) {
+            TaskNode* node = acquireNode();
+            node->task.emplace(std::forward<F>(f));
+            node->refs.store(refs, std::memory_order_relaxed);
+            return node;
+        }
+
+        friend class Completion;
+        friend class Strand;
 
     public:
+        struct track_t { explicit track_t() = default; };
+        static constexpr track_t track{};
+
         ThreadPool(size_t);
-        void submit(std::function<void()>);
-        ~ThreadPool();    
-};
\ No newline at end of file
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /**
+         * @brief Queues a task; from a worker of this pool it goes to that worker's deque
+         */
+        template <typename F>
+        void submit(F&& f) {
+            schedule(makeNode(std::forward<F>(f), 1));
+        }
+
+        /**
+         * @brief Queues a task and returns a token to wait for it
+         *
+         *   Completion done = pool.submit(ThreadPool::track, [&] { ... });
+         *   done.wait();
+         */
+        template <typename F>
+        Completion submit(track_t, F&& f) {
+            TaskNode* node = makeNode(std::forward<F>(f), 2);
+            schedule(node);
+            return Completion(this, node);
+        }
+
+        /**
+         * @brief Queues a task at the back of the shared injection queue
+         *
+         * For a task that yields: it lands behind everything already
+         * submitted from outside instead of at the hot end of the
+         * current worker's deque.
+         */
+        template <typename F>
+        void post(F&& f) {
+            schedulePosted(makeNode(std::forward<F>(f), 1));
+        }
+
+        size_t size() const { return workers.size(); }
+
+        ~ThreadPool();
+};
+
+
+/**
+ * @brief Serial executor on top of a ThreadPool
+ *
+ * Tasks submitted to the same Strand run one at a time, in submission
+ * order, but on whichever pool worker is free. Different strands run in
+ * parallel. At most one "drain" task per strand is queued on the pool at
+ * any time; it runs up to MaxTasksPerDrain tasks and then re-queues
+ * itself so one busy strand cannot starve the others.
+ *
+ * The destructor blocks until every task already submitted has run, so
+ * the pool must still be running (or be draining in its own destructor).
+ */
+class Strand {
+    private:
+        ThreadPool& pool;
+        std::mutex mx;
+        std::condition_variable idle;       // ~Strand() waits here for the drain task
+        threadpool_detail::TaskList tasks;  // Nodes borrowed from pool's cache
+        bool scheduled;     // A drain task is queued or running on the pool
+
+        static constexpr size_t MaxTasksPerDrain = 16;
+
+        void enqueue(threadpool_detail::TaskNode* node);
+        void drain();
+
+    public:
+        explicit Strand(ThreadPool& pool);
+        Strand(const Strand&) = delete;
+        Strand& operator=(const Strand&) = delete;
+        ~Strand();
+
+        template <typename F>
+        void submit(F&& f) {
+            enqueue(pool.makeNode(std::forward<F>(f), 1));
+        }
+
+        /**
+         * @brief Queues a task and returns a token; once it is ready, every
+         * task submitted to this strand before it has run as well
+         */
+        template <typename F>
+        Completion submit(ThreadPool::track_t, F&& f) {
+            threadpool_detail::TaskNode* node = pool.makeNode(std::forward<F>(f), 2);
+            enqueue(node);
+            return Completion(&pool, node);
+        }
+};
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <thread>
+
+
+/**
+ * @brief Wall-clock timestamps: reading the clock and formatting it
+ *
+ * format() writes "YYYY-MM-DD HH:MM:SS[.mmm|.uuuuuu]" in local time.
+ * Each thread caches the "YYYY-MM-DD HH:MM:SS" prefix of the last second
+ * it formatted, so localtime_r (and the global tz lock) only runs when
+ * the second changes; the fraction is patched in with to_chars.
+ *
+ * coarseNowNs() reads a value published by a Ticker thread instead of
+ * the clock: one atomic load, at the Ticker's period as resolution.
+ * Without a running Ticker it falls back to nowNs().
+ */
+class Timestamp {
+    public:
+        enum class Precision {
+            Seconds,    // 2024-01-15 10:30:00
+            Millis,     // 2024-01-15 10:30:00.123
+            Micros      // 2024-01-15 10:30:00.123456
+        };
+
+        static constexpr size_t MaxLength = 26;     // Micros
+
+        static int64_t nowNs();
+        static int64_t coarseNowNs();
+
+        /**
+         * @brief Writes the local time of 'timestampNs' (ns since the epoch)
+         * @param out At least MaxLength bytes; not NUL-terminated
+         * @return Number of bytes written
+         */
+        static size_t format(int64_t timestampNs, char* out, Precision precision = Precision::Millis);
+        static std::string format(int64_t timestampNs, Precision precision = Precision::Millis);
+
+        /**
+         * @brief Reads "YYYY-MM-DD HH:MM:SS" in local time (format() with Seconds)
+         *
+         * The date is converted arithmetically; the UTC offset comes from
+         * localtime_r once per local hour and thread, so it does not take
+         * the tz lock per call like mktime. A time in a DST gap or overlap
+         * gets one of the two offsets around it.
+         * @return false if the text is not in that form or out of range
+         */
+        static bool parse(std::string_view text, int64_t& timestampNs);
+
+        /**
+         * @brief Keeps coarseNowNs() up to date while it exists
+         *
+         * Several Tickers may coexist (all publish the same clock);
+         * coarseNowNs() falls back to the real clock after the last one
+         * is destroyed.
+         */
+        class Ticker {
+            private:
+                std::chrono::microseconds period;
+                std::atomic<bool> stop;
+                std::thread thread;
+
+                void run();
+
+            public:
+                static constexpr std::chrono::microseconds DefaultPeriod{1000};
+
+                explicit Ticker(std::chrono::microseconds period = DefaultPeriod);
+                Ticker(const Ticker&) = delete;
+                Ticker& operator=(const Ticker&) = delete;
+                ~Ticker();
+        };
+
+    private:
+        static std::atomic<int64_t> coarseNs;       // 0 while no Ticker runs
+        static std::atomic<int> tickers;
+};
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Hierarchical timing wheel for many periodic timers (one per source)
+ *
+ * Levels x Slots buckets: level 0 holds timers due within 64 ticks, level
+ * 1 within 64^2, and so on (4 levels: 2^24 ticks, about 4.6 h at 1 ms).
+ * add/remove are O(1). advance() visits only occupied slots and 64-tick
+ * boundaries, found with a per-level occupancy bitmap. A timer moves down
+ * a level at most 3 times before it expires.
+ *
+ * Timer state is kept as parallel arrays indexed by Id (due tick, period,
+ * list links, slot, caller tag), so scanning a slot does not pull whole
+ * source objects into cache.
+ *
+ * Timers with the same period get spread-out phases by default, so 10k
+ * sources at 1000 ms do not all fire in the same tick.
+ *
+ * Times are counted from 'now' as passed to add(), even if advance() has
+ * not run for a while. A periodic timer that falls behind (advance()
+ * called late) fires once and moves to its next due tick after 'now';
+ * the missed periods are skipped, not replayed.
+ *
+ * Not synchronized. onExpire may add and remove timers, including its own.
+ */
+class TimingWheel {
+    public:
+        using Clock = std::chrono::steady_clock;
+        using Id = uint32_t;
+
+        static constexpr Id None = UINT32_MAX;
+        static constexpr unsigned SlotBits = 6;
+        static constexpr unsigned Slots = 1u << SlotBits;
+        static constexpr unsigned Levels = 4;
+
+        explicit TimingWheel(std::chrono::milliseconds tick = std::chrono::milliseconds(1),
+                             Clock::time_point origin = Clock::now());
+
+        void reserve(size_t timers);
+
+        /**
+         * @brief Periodic timer (period 0: fires once), phase chosen from the Id
+         * @param now Current time; the first expiry is counted from it
+         * @param tag Caller data handed back to onExpire, e.g. an index into its own table
+         */
+        Id add(Clock::time_point now, std::chrono::milliseconds period, uint32_t tag = 0);
+
+        // First expiry 'phase' after now (at least one tick), then every period
+        Id add(Clock::time_point now, std::chrono::milliseconds period,
+               std::chrono::milliseconds phase, uint32_t tag);
+
+        void remove(Id id);
+
+        /**
+         * @brief Expires every timer due at or before now, calling onExpire(Id, tag)
+         * @return Timers expired
+         */
+        template <typename OnExpire>
+        size_t advance(Clock::time_point now, OnExpire&& onExpire) {
+            const uint64_t target = ticksAt(now);
+            size_t expired = 0;
+            while (step(target)) {
+                for (Id id = popDue(); id != None; id = popDue()) {
+                    onExpire(id, tags[id]);
+                    rearm(id, target);
+                    ++expired;
+                }
+            }
+            return expired;
+        }
+
+        // Until advance() next has work (0: overdue), or -1 ms when no timers are left
+        std::chrono::milliseconds untilNext(Clock::time_point now) const;
+
+        size_t size() const { return active; }
+        uint32_t tag(Id id) const { return tags[id]; }
+
+    private:
+        static constexpr uint16_t Free = UINT16_MAX;        // Values of slotOf besides a slot index
+        static constexpr uint16_t Firing = UINT16_MAX - 1;
+
+        // Both ends are touched on every link/unlink: one cache line, not two
+        struct Links {
+            Id next;
+            Id prev;
+        };
+
+        uint64_t ticksAt(Clock::time_point time) const;
+        uint64_t nextEventTick() const;
+        bool step(uint64_t target);
+        Id popDue();
+        void rearm(Id id, uint64_t target);
+        void place(Id id, uint64_t base);
+        void link(Id id, unsigned slot);
+        void unlink(Id id);
+        void release(Id id);
+
+        std::chrono::milliseconds tickLength;
+        Clock::time_point origin;
+        uint64_t current = 0;               // Last tick processed
+        size_t active = 0;
+
+        // Per timer, indexed by Id
+        std::vector<uint64_t> dueTick;
+        std::vector<uint32_t> periodTicks;
+        std::vector<Links> links;           // Slot list, or the free list (next)
+        std::vector<uint16_t> slotOf;       // level * Slots + index, Free or Firing
+        std::vector<uint32_t> tags;
+        Id freeList = None;
+
+        std::array<Id, Levels * Slots> heads;
+        std::array<uint64_t, Levels> occupied{};    // Bit per non-empty slot
+};
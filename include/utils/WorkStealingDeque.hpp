@@ -0,0 +1,180 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Chase-Lev work-stealing deque of pointers
+ *
+ * One OWNER thread pushes and pops at the bottom (LIFO, no atomic RMW in
+ * the common case); any number of THIEF threads steal from the top (FIFO,
+ * one CAS per steal). The only contended operation is the CAS on top_,
+ * taken by thieves and by the owner when it races for the last element.
+ *
+ * The array grows (doubles) when the owner pushes into a full deque.
+ * A thief may still be reading the old array, so replaced arrays are
+ * kept alive until the deque is destroyed.
+ *
+ * Memory orders follow Le, Pop, Cohen, Zappa Nardelli,
+ * "Correct and Efficient Work-Stealing for Weak Memory Models" (PPoPP'13).
+ *
+ * @tparam T Pointer-like, trivially copyable element type (e.g. Task*)
+ */
+template <typename T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "WorkStealingDeque stores elements in atomics");
+
+private:
+    // ============================================
+    // Member Variables
+    // ============================================
+
+    static constexpr size_t CacheLineSize = 64;
+
+    struct Array {
+        int64_t capacity;                       // Always a power of two
+        int64_t mask;
+        std::unique_ptr<std::atomic<T>[]> slots;
+
+        explicit Array(int64_t cap)
+            : capacity(cap), mask(cap - 1), slots(new std::atomic<T>[cap]) {}
+
+        T get(int64_t index) const {
+            return slots[index & mask].load(std::memory_order_relaxed);
+        }
+
+        void put(int64_t index, T value) {
+            slots[index & mask].store(value, std::memory_order_relaxed);
+        }
+    };
+
+    alignas(CacheLineSize) std::atomic<int64_t> top_;      // Next index to steal
+    alignas(CacheLineSize) std::atomic<int64_t> bottom_;   // Next index to push
+    std::atomic<Array*> array_;
+    std::vector<std::unique_ptr<Array>> arrays_;           // Owner-only: current + retired
+
+    Array* grow(Array* old, int64_t bottom, int64_t top) {
+        auto bigger = std::make_unique<Array>(old->capacity * 2);
+        for (int64_t i = top; i < bottom; ++i) {
+            bigger->put(i, old->get(i));
+        }
+        Array* raw = bigger.get();
+        arrays_.push_back(std::move(bigger));
+        array_.store(raw, std::memory_order_release);
+        return raw;
+    }
+
+public:
+    // ============================================
+    // Constructors & Destructor
+    // ============================================
+
+    /**
+     * @param initialCapacity Rounded up to a power of two (minimum 2)
+     */
+    explicit WorkStealingDeque(size_t initialCapacity = 256)
+        : top_(0), bottom_(0), array_(nullptr)
+    {
+        int64_t cap = 2;
+        while (static_cast<size_t>(cap) < initialCapacity) {
+            cap <<= 1;
+        }
+        arrays_.push_back(std::make_unique<Array>(cap));
+        array_.store(arrays_.back().get(), std::memory_order_relaxed);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+    WorkStealingDeque(WorkStealingDeque&&) = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+    // ============================================
+    // Core Functions
+    // ============================================
+
+    /**
+     * @brief Pushes at the bottom (OWNER thread only); grows when full
+     */
+    void push(T value) {
+        const int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        const int64_t top = top_.load(std::memory_order_acquire);
+        Array* array = array_.load(std::memory_order_relaxed);
+
+        if (bottom - top > array->capacity - 1) {
+            array = grow(array, bottom, top);
+        }
+
+        array->put(bottom, value);
+        // Publish the element to thieves (release instead of fence + relaxed store)
+        bottom_.store(bottom + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Pops the newest element (OWNER thread only)
+     *
+     * @return false if the deque is empty or a thief won the last element
+     */
+    bool pop(T& out) {
+        const int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        Array* array = array_.load(std::memory_order_relaxed);
+        bottom_.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = top_.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            // Empty: undo the reservation
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        out = array->get(bottom);
+        if (top == bottom) {
+            // Last element: race the thieves for it
+            const bool won = top_.compare_exchange_strong(top, top + 1,
+                                                          std::memory_order_seq_cst,
+                                                          std::memory_order_relaxed);
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Steals the oldest element (any thread)
+     *
+     * @return false if the deque is empty or another thread won the race
+     */
+    bool steal(T& out) {
+        int64_t top = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t bottom = bottom_.load(std::memory_order_acquire);
+
+        if (top >= bottom) {
+            return false;
+        }
+
+        Array* array = array_.load(std::memory_order_acquire);
+        out = array->get(top);
+        return top_.compare_exchange_strong(top, top + 1,
+                                            std::memory_order_seq_cst,
+                                            std::memory_order_relaxed);
+    }
+
+    // ============================================
+    // Getters
+    // ============================================
+
+    /**
+     * @brief Snapshot; may be stale by the time the caller acts on it
+     */
+    bool empty() const {
+        const int64_t bottom = bottom_.load(std::memory_order_acquire);
+        const int64_t top = top_.load(std::memory_order_acquire);
+        return bottom <= top;
+    }
+};
@@ -1,4 +1,8 @@
 #include "app/AppConfig.hpp"
+#include "formatter/PolicyText.hpp"
+#include "formatter/policies/CpuPolicy.hpp"
+#include "formatter/policies/GpuPolicy.hpp"
+#include "formatter/policies/RamPolicy.hpp"
 #include <json.hpp>
 #include <fstream>
 #include <stdexcept>
@@ -16,6 +20,7 @@ TelemetryType stringToTelemetryType(const std::string& str) {
 SourceType stringToSourceType(const std::string& str) {
     if (str == "socket") return SourceType::SOCKET;
     if (str == "someip") return SourceType::SOMEIP;
+    if (str == "listener") return SourceType::LISTENER;
     return SourceType::FILE;
 }
 
@@ -24,6 +29,86 @@ SinkType stringToSinkType(const std::string& str) {
     return SinkType::CONSOLE;
 }
 
+LogFormat_enum stringToLogFormat(const std::string& str) {
+    if (str == "json") return LogFormat_enum::JSON;
+    return LogFormat_enum::TEXT;
+}
+
+LogBufferType_enum stringToLogBufferType(const std::string& str) {
+    if (str == "spsc") return LogBufferType_enum::SPSC;
+    if (str == "mpmc") return LogBufferType_enum::MPMC;
+    return LogBufferType_enum::MUTEX;
+}
+
+LogOverflowPolicy_enum stringToOverflowPolicy(const std::string& str) {
+    if (str == "block") return LogOverflowPolicy_enum::BLOCK;
+    if (str == "drop_oldest") return LogOverflowPolicy_enum::DROP_OLDEST;
+    if (str == "sample") return LogOverflowPolicy_enum::SAMPLE;
+    return LogOverflowPolicy_enum::DROP_NEWEST;
+}
+
+namespace {
+
+template <typename _PolicyType>
+void builtInPolicy(SourceConfig& sc) {
+    sc.warning = _PolicyType::WARNING;
+    sc.critical = _PolicyType::CRITICAL;
+    sc.unit = std::string(_PolicyType::unit);
+}
+
+bool isBuiltInType(const std::string& str) {
+    return str == "CPU" || str == "GPU" || str == "RAM";
+}
+
+// Thresholds/unit: built-in defaults, overridden field by field
+void loadPolicy(const json& src, SourceConfig& sc) {
+    switch (sc.telemetryType) {
+        case TelemetryType::CPU: builtInPolicy<CpuPolicy>(sc); break;
+        case TelemetryType::GPU: builtInPolicy<GpuPolicy>(sc); break;
+        case TelemetryType::RAM: builtInPolicy<RamPolicy>(sc); break;
+    }
+
+    const bool newKind = !isBuiltInType(sc.metricName);
+    if (newKind && (!src.contains("warning") || !src.contains("critical"))) {
+        throw std::runtime_error("Source with telemetryType \"" + sc.metricName +
+                                 "\" needs \"warning\" and \"critical\"");
+    }
+
+    sc.customPolicy = newKind;
+    if (src.contains("warning")) {
+        sc.warning = src["warning"].get<float>();
+        sc.customPolicy = true;
+    }
+    if (src.contains("critical")) {
+        sc.critical = src["critical"].get<float>();
+        sc.customPolicy = true;
+    }
+    if (src.contains("unit")) {
+        sc.unit = src["unit"].get<std::string>();
+        sc.customPolicy = true;
+    } else if (newKind) {
+        sc.unit.clear();
+    }
+}
+
+// What happens to each sample: policy, rollup window, debouncing
+void loadStages(const json& src, SourceConfig& sc) {
+    sc.metricName = src["telemetryType"].get<std::string>();
+    sc.telemetryType = stringToTelemetryType(sc.metricName);
+    loadPolicy(src, sc);
+    if (src.contains("windowMs")) {
+        sc.windowMs = src["windowMs"].get<uint32_t>();
+    }
+    if (src.contains("debounce")) {
+        auto& db = src["debounce"];
+        if (db.contains("hysteresis"))  sc.hysteresis = db["hysteresis"].get<float>();
+        if (db.contains("minDwellMs"))  sc.minDwellMs = db["minDwellMs"].get<uint32_t>();
+        if (db.contains("heartbeatMs")) sc.heartbeatMs = db["heartbeatMs"].get<uint32_t>();
+    }
+}
+
+}
+
 AppConfig loadConfig(const std::string& filePath) {
     std::ifstream file(filePath);
     if (!file.is_open()) {
@@ -53,8 +138,36 @@ AppConfig loadConfig(const std::string& filePath) {
                 sc.path = src["path"].get<std::string>();
             }
             
-            sc.telemetryType = stringToTelemetryType(src["telemetryType"].get<std::string>());
-            sc.rateMs = src["rateMs"].get<uint32_t>();
+            // Listeners are driven by their producers: no polling rate. Every
+            // other type is read on a wheel timer, where 0 ms would fire once
+            sc.rateMs = src.contains("rateMs") ? src["rateMs"].get<uint32_t>() : 0;
+            if (sc.sourceType != SourceType::LISTENER && sc.rateMs == 0) {
+                throw std::runtime_error("Source of type \"" + src["type"].get<std::string>() +
+                                         "\" needs \"rateMs\" greater than 0");
+            }
+            loadStages(src, sc);
+            if (src.contains("readTimeoutMs")) {
+                sc.readTimeoutMs = src["readTimeoutMs"].get<uint32_t>();
+            }
+            if (src.contains("reconnect")) {
+                auto& rc = src["reconnect"];
+                if (rc.contains("minMs")) sc.reconnectMinMs = rc["minMs"].get<uint32_t>();
+                if (rc.contains("maxMs")) sc.reconnectMaxMs = rc["maxMs"].get<uint32_t>();
+            }
+            if (src.contains("maxConnections")) {
+                sc.maxConnections = src["maxConnections"].get<uint32_t>();
+            }
+            if (src.contains("routes")) {
+                for (auto& rt : src["routes"]) {
+                    SourceConfig route;
+                    route.sourceType = sc.sourceType;
+                    route.path = sc.path;
+                    route.rateMs = 0;
+                    loadStages(rt, route);
+                    route.tag = rt.contains("tag") ? rt["tag"].get<std::string>() : route.metricName;
+                    sc.routes.push_back(route);
+                }
+            }
             
             config.sources.push_back(sc);
         }
@@ -70,11 +183,34 @@ AppConfig loadConfig(const std::string& filePath) {
             if (snk.contains("path")) {
                 sc.path = snk["path"].get<std::string>();
             }
+            if (snk.contains("flushBytes")) {
+                sc.flushBytes = snk["flushBytes"].get<size_t>();
+            }
+            if (snk.contains("flushIntervalMs")) {
+                sc.flushIntervalMs = snk["flushIntervalMs"].get<uint32_t>();
+            }
+            if (snk.contains("format")) {
+                sc.format = stringToLogFormat(snk["format"].get<std::string>());
+            }
             
             config.sinks.push_back(sc);
         }
     }
 
+    // Logger (optional, defaults match the previous hard-coded values)
+    if (j.contains("logger")) {
+        auto& lg = j["logger"];
+        LoggerConfig& lc = config.logger;
+
+        if (lg.contains("bufferSize"))     lc.bufferSize = lg["bufferSize"].get<size_t>();
+        if (lg.contains("threadPoolSize")) lc.threadPoolSize = lg["threadPoolSize"].get<size_t>();
+        if (lg.contains("batchSize"))      lc.batchSize = lg["batchSize"].get<size_t>();
+        if (lg.contains("bufferType"))     lc.bufferType = stringToLogBufferType(lg["bufferType"].get<std::string>());
+        if (lg.contains("overflowPolicy")) lc.overflowPolicy = stringToOverflowPolicy(lg["overflowPolicy"].get<std::string>());
+        if (lg.contains("blockTimeoutMs")) lc.blockTimeoutMs = lg["blockTimeoutMs"].get<uint32_t>();
+        if (lg.contains("sampleEvery"))    lc.sampleEvery = lg["sampleEvery"].get<uint32_t>();
+    }
+
     return config;
 }
 
@@ -1,11 +1,13 @@
 #include "app/TelemetryApp.hpp"
 #include "sources/FileTelemetrySourceImpl.hpp"
 #include "sources/SocketTelemetrySourceImpl.hpp"
+#include "sources/ListenerTelemetrySourceImpl.hpp"
 #include "sinks/ConsoleSinkImpl.hpp"
 #include "sinks/FileSinkImpl.hpp"
 
 #include <iostream>
 #include <csignal>
+#include <sys/epoll.h>
 
 #ifdef SOMEIP_ENABLED
 #include "sources/SomeIPTelemetrySourceAdapter.hpp"
@@ -14,10 +16,14 @@
 namespace telemetry {
 
 static volatile std::sig_atomic_t g_stopRequested = 0;
+static Reactor* volatile g_reactor = nullptr;      // Woken by the handler (eventfd write)
 
 void handleSignal(int sig) {
     (void)sig;
     g_stopRequested = 1;
+    if (g_reactor != nullptr) {
+        g_reactor->stop();
+    }
 }
 
 TelemetryApp::TelemetryApp(const std::string& configPath) 
@@ -37,19 +43,57 @@ TelemetryApp::~TelemetryApp() {
     // 1. Stop the main loop
     running_.store(false);
     g_stopRequested = 1;
+    if (g_reactor == reactor_.get()) {
+        g_reactor = nullptr;
+    }
     
-    // 2. Wait for mainLoop to exit
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    // 2. Wait until everything already logged is written to the sinks
+    if (logManager_) {
+        logManager_->flush();
+    }
     
-    // 3. Clear sources
+    // 3. Clear sources (after reporting what debouncing kept out of the sinks)
+    uint64_t debounced = 0;
+    for (const auto& entry : sources_) {
+        if (entry.debouncer) {
+            debounced += entry.debouncer->suppressedCount();
+        }
+    }
+    if (debounced > 0) {
+        std::cout << "[App] Debounced: " << debounced << " samples not logged" << std::endl;
+    }
+    for (const auto& entry : sources_) {
+        if (entry.connection) {
+            const ConnectionState& connection = *entry.connection;
+            std::cout << "[App] " << entry.name << ": connects " << connection.connects
+                      << ", failed attempts " << connection.failedAttempts
+                      << ", hang-ups " << connection.hangups
+                      << ", read timeouts " << connection.timeouts << std::endl;
+        }
+        if (entry.listener) {
+            std::cout << "[App] " << entry.name << ": accepted " << entry.listener->acceptedCount()
+                      << ", rejected " << entry.listener->rejectedCount()
+                      << ", disconnected " << entry.listener->disconnectedCount()
+                      << ", open " << entry.listener->connectionCount() << std::endl;
+        }
+    }
     sources_.clear();
     
     // 4. Clear formatters
     cpuFormatter_.reset();
     gpuFormatter_.reset();
     ramFormatter_.reset();
+    policyTable_.reset();
     
-    // 5. Destroy LogManager - it owns and will delete the sinks
+    // 5. Report overflow losses, then destroy LogManager - it owns and will delete the sinks
+    if (logManager_) {
+        std::cout << "[App] Logged: " << logManager_->getEnqueuedCount()
+                  << ", dropped: " << logManager_->getDroppedCount()
+                  << " (CRITICAL " << logManager_->getDroppedCount(SeverityLvl_enum::CRITICAL)
+                  << ", WARNING " << logManager_->getDroppedCount(SeverityLvl_enum::WARNING)
+                  << ", INFO " << logManager_->getDroppedCount(SeverityLvl_enum::INFO) << ")"
+                  << std::endl;
+    }
     logManager_.reset();
     
     std::cout << "[App] Cleanup complete" << std::endl;
@@ -62,10 +106,22 @@ void TelemetryApp::initialize() {
     cpuFormatter_ = std::make_unique<LogFormatter<CpuPolicy>>(config_.appName);
     gpuFormatter_ = std::make_unique<LogFormatter<GpuPolicy>>(config_.appName);
     ramFormatter_ = std::make_unique<LogFormatter<RamPolicy>>(config_.appName);
+    policyTable_ = std::make_unique<PolicyTable>(config_.appName);
+    reactor_ = std::make_unique<Reactor>();
 
     // Create LogManager first
-    // 100 message buffer, 4 threads for parallel sink writing
-    logManager_ = std::make_unique<LogManager>(100, 4);
+    // buffer size, pool size and overflow behaviour come from the "logger" section
+    const LoggerConfig& loggerCfg = config_.logger;
+    logManager_ = std::make_unique<LogManager>(loggerCfg.bufferSize,
+                                               loggerCfg.threadPoolSize,
+                                               loggerCfg.bufferType);
+
+    LogOverflowConfig overflow;
+    overflow.policy = loggerCfg.overflowPolicy;
+    overflow.blockTimeout = std::chrono::milliseconds(loggerCfg.blockTimeoutMs);
+    overflow.sampleEvery = loggerCfg.sampleEvery;
+    logManager_->setOverflowPolicy(overflow);
+    logManager_->setBatchSize(loggerCfg.batchSize);
     
     // Create sinks and add to LogManager (LogManager takes ownership)
     createSinks();
@@ -83,10 +139,12 @@ void TelemetryApp::createSinks() {
         
         switch (sinkCfg.sinkType) {
             case SinkType::CONSOLE:
-                sink = new ConsoleSinkImpl();
+                sink = new ConsoleSinkImpl(sinkCfg.format);
                 break;
             case SinkType::FILE:
-                sink = new FileSinkImpl(sinkCfg.path);
+                sink = new FileSinkImpl(sinkCfg.path, sinkCfg.flushBytes,
+                                        std::chrono::milliseconds(sinkCfg.flushIntervalMs),
+                                        sinkCfg.format);
                 break;
         }
         
@@ -97,12 +155,28 @@ void TelemetryApp::createSinks() {
     }
 }
 
+void TelemetryApp::createStages(SourceEntry& entry, const SourceConfig& srcCfg) {
+    entry.type = srcCfg.telemetryType;
+    if (srcCfg.customPolicy) {
+        entry.policyId = policyTable_->add(srcCfg.metricName, srcCfg.unit,
+                                           srcCfg.warning, srcCfg.critical);
+    }
+    DebounceConfig debounce;
+    debounce.hysteresis = srcCfg.hysteresis;
+    debounce.minDwell = std::chrono::milliseconds(srcCfg.minDwellMs);
+    debounce.heartbeat = std::chrono::milliseconds(srcCfg.heartbeatMs);
+    if (srcCfg.windowMs > 0) {
+        entry.window.emplace(std::chrono::milliseconds(srcCfg.windowMs), srcCfg.warning, srcCfg.critical);
+    } else if (debounce.enabled()) {
+        entry.debouncer.emplace(srcCfg.warning, srcCfg.critical, debounce);
+    }
+    entry.rateMs = srcCfg.rateMs;
+}
+
 void TelemetryApp::createSources() {
     for (auto& srcCfg : config_.sources) {
         SourceEntry entry;
-        entry.type = srcCfg.telemetryType;
-        entry.rateMs = srcCfg.rateMs;
-        entry.lastRead = std::chrono::steady_clock::now();
+        createStages(entry, srcCfg);
 
         switch (srcCfg.sourceType) {
             case SourceType::FILE:
@@ -114,9 +188,35 @@ void TelemetryApp::createSources() {
             case SourceType::SOCKET:
                 entry.source = std::make_unique<SocketTelemetrySourceImpl>(srcCfg.path);
                 entry.name = "Socket[" + srcCfg.path + "]";
+                entry.connection.emplace(Backoff(std::chrono::milliseconds(srcCfg.reconnectMinMs),
+                                                 std::chrono::milliseconds(srcCfg.reconnectMaxMs),
+                                                 static_cast<uint32_t>(sources_.size()) + 1),
+                                         std::chrono::milliseconds(srcCfg.readTimeoutMs));
                 std::cout << "[App] + Socket source: " << srcCfg.path << std::endl;
                 break;
 
+            case SourceType::LISTENER: {
+                auto listener = std::make_unique<ListenerTelemetrySourceImpl>(srcCfg.path, srcCfg.maxConnections);
+                entry.listener = listener.get();
+                entry.source = std::move(listener);
+                entry.name = "Listener[" + srcCfg.path + "]";
+                std::cout << "[App] + Listener source: " << srcCfg.path << std::endl;
+
+                // Each route is an entry of its own (policy, window, debouncer),
+                // fed by the listener instead of a source
+                const size_t listenerIndex = sources_.size();
+                sources_.push_back(std::move(entry));
+                for (const auto& routeCfg : srcCfg.routes) {
+                    SourceEntry route;
+                    createStages(route, routeCfg);
+                    route.name = sources_[listenerIndex].name + " " + routeCfg.tag;
+                    sources_[listenerIndex].routes.push_back({routeCfg.tag, sources_.size()});
+                    sources_.push_back(std::move(route));
+                    std::cout << "[App]   route " << routeCfg.tag << " -> " << routeCfg.metricName << std::endl;
+                }
+                continue;
+            }
+
             case SourceType::SOMEIP:
 #ifdef SOMEIP_ENABLED
                 entry.source = std::make_unique<SomeIPTelemetrySourceAdapter>();
@@ -137,10 +237,17 @@ void TelemetryApp::createSources() {
 
 void TelemetryApp::openSources() {
     for (auto& entry : sources_) {
-        if (entry.source && entry.source->openSource()) {
+        if (!entry.source) continue;      // Listener route: fed by its listener
+        const bool opened = entry.source->openSource();
+        if (entry.connection) {
+            entry.connection->connected = opened;
+            ++(opened ? entry.connection->connects : entry.connection->failedAttempts);
+        }
+        if (opened) {
             std::cout << "[App] ✓ Opened: " << entry.name << std::endl;
         } else {
-            std::cout << "[App] ✗ Failed: " << entry.name << std::endl;
+            std::cout << "[App] ✗ Failed: " << entry.name
+                      << (entry.connection ? " (retrying)" : "") << std::endl;
         }
     }
 }
@@ -151,6 +258,7 @@ void TelemetryApp::start() {
     printBanner();
     
     g_stopRequested = 0;
+    g_reactor = reactor_.get();
     
     std::signal(SIGINT, handleSignal);
     std::signal(SIGTERM, handleSignal);
@@ -170,6 +278,7 @@ void TelemetryApp::start() {
 void TelemetryApp::stop() {
     running_.store(false);
     g_stopRequested = 1;
+    reactor_->stop();
 }
 
 bool TelemetryApp::isRunning() const {
@@ -177,63 +286,288 @@ bool TelemetryApp::isRunning() const {
 }
 
 void TelemetryApp::mainLoop() {
-    while (running_.load() && g_stopRequested == 0) {
-        auto now = std::chrono::steady_clock::now();
-
-        for (auto& entry : sources_) {
-            if (!running_.load() || g_stopRequested != 0) break;
-            
-            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-                now - entry.lastRead).count();
-
-            if (elapsed >= entry.rateMs) {
-                processSource(entry);
-                entry.lastRead = now;
+    schedulerTimer_ = reactor_->addTimer([this](uint32_t) { runScheduler(); });
+    const auto start = std::chrono::steady_clock::now();
+
+    // sources_ does not change while the loop runs: handlers keep pointers to entries
+    for (size_t index = 0; index < sources_.size(); ++index) {
+        SourceEntry& entry = sources_[index];
+        const uint32_t tag = static_cast<uint32_t>(index) * TimerKinds;
+
+        // Sockets wake the loop when data arrives; one that is not connected
+        // is retried with backoff. Regular files cannot be polled and are
+        // read every rateMs, like SOME/IP. Listener routes have no source
+        if (entry.connection) {
+            if (!entry.connection->connected || !watchSource(entry)) {
+                entry.connection->connected = false;
+                scheduleConnectionTimer(entry, entry.connection->backoff.next());
             }
+        } else if (entry.source && !watchSource(entry) && !entry.listener) {
+            entry.readTimer = scheduler_.add(start, std::chrono::milliseconds(entry.rateMs), tag + ReadTimer);
         }
 
-        for (int i = 0; i < 5 && running_.load() && g_stopRequested == 0; ++i) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        if (entry.window) {
+            entry.windowTimer = scheduler_.add(start, entry.window->length(), tag + WindowTimer);
         }
     }
+    runScheduler();
+
+    // Sleeps in epoll_wait until data, a timer or stop()/a signal
+    // (returns at once if stop() already came)
+    reactor_->run();
+
+    for (auto& entry : sources_) {
+        if (entry.watchedFd >= 0) reactor_->unwatch(entry.watchedFd);
+        scheduler_.remove(entry.readTimer);
+        scheduler_.remove(entry.windowTimer);
+        entry.watchedFd = -1;
+        entry.readTimer = entry.windowTimer = TimingWheel::None;
+        if (entry.connection) {
+            scheduler_.remove(entry.connection->timer);
+            entry.connection->timer = TimingWheel::None;
+        }
+
+        // Partial windows still hold samples nobody has seen
+        if (entry.window && entry.window->count() > 0) {
+            closeWindow(entry);
+        }
+    }
+    reactor_->removeTimer(schedulerTimer_);
+    schedulerTimer_ = -1;
     
     running_.store(false);
 }
 
-void TelemetryApp::processSource(SourceEntry& entry) {
+void TelemetryApp::runScheduler() {
+    const auto now = std::chrono::steady_clock::now();
+    schedulerRunning_ = true;
+    scheduler_.advance(now, [this, now](TimingWheel::Id, uint32_t tag) {
+        SourceEntry& entry = sources_[tag / TimerKinds];
+        switch (tag % TimerKinds) {
+            case ReadTimer:
+                processSource(entry, now);
+                break;
+            case WindowTimer:
+                if (entry.window->count() > 0) {
+                    closeWindow(entry);
+                }
+                break;
+            case ConnectionTimer:
+                checkConnection(entry, now);
+                break;
+        }
+    });
+    schedulerRunning_ = false;
+    rearmScheduler();
+}
+
+void TelemetryApp::rearmScheduler() {
+    // Timers added outside runScheduler (a socket handler disconnecting, a
+    // new read deadline) may be due before the one the Reactor timer is set for
+    if (schedulerRunning_ || schedulerTimer_ < 0) return;
+
+    // One-shot to the next expiry, so an idle loop does not wake every tick
+    const auto delay = scheduler_.untilNext(std::chrono::steady_clock::now());
+    if (delay.count() >= 0) {
+        reactor_->arm(schedulerTimer_, delay);
+    }
+}
+
+void TelemetryApp::processSource(SourceEntry& entry, std::chrono::steady_clock::time_point now) {
     if (!running_.load() || g_stopRequested != 0) return;
     if (!entry.source) return;
     
     std::string data;
     
     if (entry.source->readSource(data) && !data.empty()) {
-        auto msg = formatData(data, entry.type);
-        if (msg.has_value() && running_.load() && logManager_) {
-            logManager_->log(msg.value());
+        handleSample(entry, data, now);
+    }
+}
+
+void TelemetryApp::drainSource(SourceEntry& entry, uint32_t events) {
+    const auto now = std::chrono::steady_clock::now();
+    std::string data;
+
+    // Every line already received, but bounded so one busy source cannot
+    // starve the others (epoll reports it again if more is left). After a
+    // hang-up nothing more will come: take all of it
+    const bool hangup = (events & (EPOLLHUP | EPOLLRDHUP | EPOLLERR)) != 0;
+    bool open = true;
+    size_t lines = 0;
+    for (; hangup || lines < MaxLinesPerWake; ++lines) {
+        if (!running_.load() || g_stopRequested != 0) return;
+        if (!entry.source->readSource(data)) {
+            open = false;
+            break;
+        }
+        if (data.empty()) break;
+        handleSample(routeOf(entry, data), data, now);
+    }
+
+    if (entry.connection && lines > 0) {
+        entry.connection->lastData = now;
+    }
+    // Stopped at the cap: what is left may already sit in the source's
+    // buffer, where epoll cannot see it
+    if (lines == MaxLinesPerWake && !hangup) {
+        SourceEntry* source = &entry;
+        reactor_->defer([this, source] {
+            if (source->watchedFd >= 0) {
+                drainSource(*source, 0);
+            }
+        });
+    }
+    if (hangup || !open) {
+        if (entry.connection) {
+            ++entry.connection->hangups;
+            disconnectSource(entry, "peer closed");
+        } else {
+            reactor_->unwatch(entry.watchedFd);
+            entry.watchedFd = -1;
+            std::cout << "[App] ✗ Closed: " << entry.name << std::endl;
         }
     }
 }
 
-std::optional<LogMessage> TelemetryApp::formatData(const std::string& data, TelemetryType type) {
-    if (data.empty()) {
-        return std::nullopt;
+SourceEntry& TelemetryApp::routeOf(SourceEntry& entry, std::string_view data) {
+    if (entry.routes.empty()) {
+        return entry;
     }
-    
-    try {
-        switch (type) {
-            case TelemetryType::CPU:
-                return cpuFormatter_->formatDataToLogMsg(data);
-            case TelemetryType::GPU:
-                return gpuFormatter_->formatDataToLogMsg(data);
-            case TelemetryType::RAM:
-                return ramFormatter_->formatDataToLogMsg(data);
-        }
-    } catch (...) {
-        // Ignore format errors
+    const std::string_view label = ListenerTelemetrySourceImpl::labelOf(data);
+    for (const Route& route : entry.routes) {
+        if (route.tag == label) {
+            return sources_[route.entry];
+        }
+    }
+    return entry;
+}
+
+bool TelemetryApp::watchSource(SourceEntry& entry) {
+    SourceEntry* source = &entry;
+    const int fd = entry.source->sourceFd();
+    if (fd < 0 || !reactor_->watch(fd, EPOLLIN | EPOLLRDHUP,
+                                   [this, source](uint32_t events) { drainSource(*source, events); })) {
+        return false;
+    }
+    entry.watchedFd = fd;
+
+    if (entry.connection && entry.connection->readTimeout.count() > 0) {
+        entry.connection->lastData = std::chrono::steady_clock::now();
+        scheduleConnectionTimer(entry, entry.connection->readTimeout);
+    }
+    return true;
+}
+
+void TelemetryApp::scheduleConnectionTimer(SourceEntry& entry, std::chrono::milliseconds delay) {
+    const uint32_t tag = static_cast<uint32_t>(&entry - sources_.data()) * TimerKinds + ConnectionTimer;
+    scheduler_.remove(entry.connection->timer);
+    entry.connection->timer = scheduler_.add(std::chrono::steady_clock::now(), std::chrono::milliseconds(0), delay, tag);
+    rearmScheduler();
+}
+
+void TelemetryApp::checkConnection(SourceEntry& entry, std::chrono::steady_clock::time_point now) {
+    ConnectionState& connection = *entry.connection;
+    connection.timer = TimingWheel::None;       // One-shot: gone after this call
+    if (!running_.load() || g_stopRequested != 0) return;
+
+    if (!connection.connected) {
+        connectSource(entry);
+        return;
+    }
+
+    // Read deadline: data since it was armed pushes it back instead of re-arming on every line
+    const auto quiet = now - connection.lastData;
+    if (quiet < connection.readTimeout) {
+        scheduleConnectionTimer(entry, std::chrono::ceil<std::chrono::milliseconds>(connection.readTimeout - quiet));
+        return;
+    }
+    ++connection.timeouts;
+    disconnectSource(entry, "read timeout");
+}
+
+void TelemetryApp::connectSource(SourceEntry& entry) {
+    ConnectionState& connection = *entry.connection;
+    if (entry.source->openSource() && watchSource(entry)) {
+        connection.connected = true;
+        ++connection.connects;
+        std::cout << "[App] ✓ Reconnected: " << entry.name
+                  << " (attempt " << connection.backoff.attempts() << ")" << std::endl;
+        connection.backoff.reset();
+        return;
+    }
+    // Quietly: the closing message already said it is being retried
+    ++connection.failedAttempts;
+    entry.source->closeSource();
+    scheduleConnectionTimer(entry, connection.backoff.next());
+}
+
+void TelemetryApp::disconnectSource(SourceEntry& entry, const char* reason) {
+    ConnectionState& connection = *entry.connection;
+    reactor_->unwatch(entry.watchedFd);
+    entry.watchedFd = -1;
+    entry.source->closeSource();
+    connection.connected = false;
+
+    const std::chrono::milliseconds delay = connection.backoff.next();
+    scheduleConnectionTimer(entry, delay);
+    std::cout << "[App] ✗ Closed: " << entry.name << " (" << reason
+              << "), reconnecting in " << delay.count() << " ms" << std::endl;
+}
+
+void TelemetryApp::handleSample(SourceEntry& entry, std::string_view data,
+                                std::chrono::steady_clock::time_point now) {
+    auto msg = formatData(data, entry);
+    if (!msg.has_value()) return;
+    if (entry.window) {
+        if (auto value = msg->GetValue()) {
+            entry.window->add(*value, now);
+        }
+        return;
+    }
+    if (entry.debouncer && !entry.debouncer->admit(*msg, now)) return;
+    if (running_.load() && logManager_) {
+        logManager_->log(msg.value());
+    }
+}
+
+std::optional<LogMessage> TelemetryApp::formatData(std::string_view data, const SourceEntry& entry) {
+    // Unparsable lines are counted (and reported rate-limited) by SampleParser
+    if (entry.policyId.has_value()) {
+        return policyTable_->formatDataToLogMsg(*entry.policyId, data);
+    }
+    switch (entry.type) {
+        case TelemetryType::CPU:
+            return cpuFormatter_->formatDataToLogMsg(data);
+        case TelemetryType::GPU:
+            return gpuFormatter_->formatDataToLogMsg(data);
+        case TelemetryType::RAM:
+            return ramFormatter_->formatDataToLogMsg(data);
     }
     return std::nullopt;
 }
 
+void TelemetryApp::closeWindow(SourceEntry& entry) {
+    const WindowSummary summary = entry.window->summary();
+    entry.window->reset();
+    if (!logManager_) return;
+
+    if (entry.policyId.has_value()) {
+        logManager_->log(policyTable_->formatWindowToLogMsg(*entry.policyId, summary));
+        return;
+    }
+    switch (entry.type) {
+        case TelemetryType::CPU:
+            logManager_->log(cpuFormatter_->formatWindowToLogMsg(summary));
+            break;
+        case TelemetryType::GPU:
+            logManager_->log(gpuFormatter_->formatWindowToLogMsg(summary));
+            break;
+        case TelemetryType::RAM:
+            logManager_->log(ramFormatter_->formatWindowToLogMsg(summary));
+            break;
+    }
+}
+
 void TelemetryApp::printBanner() {
     std::cout << std::endl;
     std::cout << "========================================" << std::endl;
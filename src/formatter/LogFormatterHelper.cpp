@@ -1,19 +1,51 @@
 
 
-#include <chrono>
-#include <iomanip>
+#include <charconv>
 #include <string_view>
+#include <utility>
 #include "formatter/LogFormatterHelper.hpp"
+#include "formatter/PolicyText.hpp"
+#include "utils/Timestamp.hpp"
 
 
 std::string LogFormatterHelper::GetDescription(float value,
                                                const std::string &context,
                                                const std::string_view& unit){
     std::string msg;
-    msg+= context;
-    msg+= "usage : ";
-    msg+= std::to_string(value); 
-    msg += std::string(unit);
+    msg.reserve(context.size() + SampleText::MaxBodyLength("usage : ", unit));
+    msg += context;
+    SampleText::AppendBody(msg, "usage : ", value, unit);
+    return msg;
+}
+
+std::string LogFormatterHelper::GetWindowDescription(const WindowSummary& summary,
+                                                     std::string_view context,
+                                                     std::string_view unit){
+    const std::pair<const char*, float> fields[] = {
+        {" min=", summary.min}, {" mean=", summary.mean}, {" max=", summary.max},
+        {" p50=", summary.p50}, {" p95=", summary.p95}, {" p99=", summary.p99}
+    };
+
+    std::string msg;
+    msg.reserve(context.size() + 48 + 6 * (16 + unit.size()));
+    msg += context;
+    msg += "usage[";
+    msg += std::to_string(summary.length.count());
+    msg += "ms] : n=";
+    msg += std::to_string(summary.count);
+    for (const auto& field : fields) {
+        char number[48];
+        const char* end = std::to_chars(number, number + sizeof(number), field.second, std::chars_format::fixed, 2).ptr;
+        msg += field.first;
+        msg.append(number, static_cast<size_t>(end - number));
+        msg += unit;
+    }
+    if (summary.classified) {
+        msg += " warning=";
+        msg += std::to_string(summary.warning);
+        msg += " critical=";
+        msg += std::to_string(summary.critical);
+    }
     return msg;
 }
 
@@ -27,13 +59,21 @@ std::string LogFormatterHelper::GetSeverity(float value,float criticalThreshold,
     }
 }
 
+SeverityLvl_enum LogFormatterHelper::GetSeverityLevel(float value,float criticalThreshold,float warningThreshold){
+    if(value > criticalThreshold){
+        return SeverityLvl_enum::CRITICAL;
+    }else if(value > warningThreshold){
+        return SeverityLvl_enum::WARNING;
+    }else{
+        return SeverityLvl_enum::INFO;
+    }
+}
+
 std::string LogFormatterHelper::GetCurrentTimeStamp() {
-    auto now = std::chrono::system_clock::now();
-    auto time = std::chrono::system_clock::to_time_t(now);
-    
-    std::ostringstream oss;
-    oss << std::put_time(std::localtime(&time), "%Y-%m-%d %H:%M:%S");
-    
-    return oss.str();
+    return Timestamp::format(Timestamp::nowNs(), Timestamp::Precision::Seconds);
 }
 
+// Coarse clock when the caller runs a Timestamp::Ticker, real clock (vDSO) otherwise
+int64_t LogFormatterHelper::GetCurrentTimeNs() {
+    return Timestamp::coarseNowNs();
+}
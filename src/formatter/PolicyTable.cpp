@@ -0,0 +1,69 @@
+#include <iostream>
+#include <limits>
+#include "formatter/LogFormatterHelper.hpp"
+#include "formatter/PolicyTable.hpp"
+#include "formatter/SampleParser.hpp"
+
+
+PolicyTable::PolicyTable(const std::string &appName)
+    : AppName(appName)
+    , AppId(StringInterner::instance().intern(appName)) {}
+
+PolicyTable::SourceId PolicyTable::add(std::string_view context, std::string_view unit,
+                                       float warning, float critical) {
+    if (entries.size() > std::numeric_limits<SourceId>::max()) {
+        std::cerr << "Error: PolicyTable is full, reusing the last policy for " << context << std::endl;
+        return static_cast<SourceId>(entries.size() - 1);
+    }
+
+    StringInterner& interner = StringInterner::instance();
+    const std::string contextName(context);
+
+    Entry entry;
+    entry.warning = warning;
+    entry.critical = critical;
+    entry.contextId = interner.intern(contextName);
+    entry.format.bodyPrefix = interner.intern(contextName + "usage : ");
+    entry.format.unit = interner.intern(unit);
+    entry.format.sourcePrefix = interner.intern("(" + AppName + " - " + contextName + ")");
+
+    entries.push_back(entry);
+    return static_cast<SourceId>(entries.size() - 1);
+}
+
+LogMessage PolicyTable::formatValueToLogMsg(SourceId id, float value) const {
+    const Entry& entry = entries[id];
+    return LogMessage(
+        AppId,
+        entry.contextId,
+        classify(id, value),
+        LogFormatterHelper::GetCurrentTimeNs(),
+        value,
+        entry.format
+    );
+}
+
+std::optional<LogMessage> PolicyTable::formatDataToLogMsg(SourceId id, std::string_view raw) const {
+    if (id >= entries.size()) {
+        return std::nullopt;
+    }
+    const SampleParseResult parsed = SampleParser::parse(raw);
+    if (!parsed) {
+        SampleParser::report(parsed.error, raw);
+        return std::nullopt;
+    }
+    return formatValueToLogMsg(id, parsed.value);
+}
+
+LogMessage PolicyTable::formatWindowToLogMsg(SourceId id, const WindowSummary& summary) const {
+    const Entry& entry = entries[id];
+    const StringInterner& interner = StringInterner::instance();
+    return LogMessage(
+        AppId,
+        entry.contextId,
+        classify(id, summary.max),
+        LogFormatterHelper::GetCurrentTimeNs(),
+        LogFormatterHelper::GetWindowDescription(summary, interner.lookup(entry.contextId),
+                                                 interner.lookup(entry.format.unit))
+    );
+}
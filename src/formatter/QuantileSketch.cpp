@@ -0,0 +1,89 @@
+#include <algorithm>
+#include "formatter/QuantileSketch.hpp"
+
+
+QuantileSketch::QuantileSketch(double quantile) : quantile(quantile) {
+    reset();
+}
+
+void QuantileSketch::reset() {
+    samples = 0;
+    const double q = quantile;
+    const double initialDesired[Markers] = {1.0, 1.0 + 2.0 * q, 1.0 + 4.0 * q, 3.0 + 2.0 * q, 5.0};
+    const double initialIncrements[Markers] = {0.0, q / 2.0, q, (1.0 + q) / 2.0, 1.0};
+    for (int i = 0; i < Markers; ++i) {
+        heights[i] = 0.0;
+        positions[i] = i + 1;
+        desired[i] = initialDesired[i];
+        increments[i] = initialIncrements[i];
+    }
+}
+
+void QuantileSketch::add(float value) {
+    const double x = value;
+
+    // The first five samples are the markers themselves, kept sorted
+    if (samples < Markers) {
+        heights[samples++] = x;
+        std::sort(heights, heights + samples);
+        return;
+    }
+    ++samples;
+
+    int cell;
+    if (x < heights[0]) {
+        heights[0] = x;
+        cell = 0;
+    } else if (x >= heights[Markers - 1]) {
+        heights[Markers - 1] = x;
+        cell = Markers - 2;
+    } else {
+        cell = 0;
+        while (x >= heights[cell + 1]) {
+            ++cell;
+        }
+    }
+
+    for (int i = cell + 1; i < Markers; ++i) {
+        positions[i] += 1.0;
+    }
+    for (int i = 0; i < Markers; ++i) {
+        desired[i] += increments[i];
+    }
+
+    // Move the middle markers toward their desired positions, one step at most
+    for (int i = 1; i < Markers - 1; ++i) {
+        const double offset = desired[i] - positions[i];
+        if ((offset >= 1.0 && positions[i + 1] - positions[i] > 1.0) ||
+            (offset <= -1.0 && positions[i - 1] - positions[i] < -1.0)) {
+            const int d = (offset > 0.0) ? 1 : -1;
+            const double candidate = parabolic(i, d);
+            heights[i] = (heights[i - 1] < candidate && candidate < heights[i + 1]) ? candidate : linear(i, d);
+            positions[i] += d;
+        }
+    }
+}
+
+double QuantileSketch::parabolic(int i, int d) const {
+    const double below = positions[i] - positions[i - 1];
+    const double above = positions[i + 1] - positions[i];
+    return heights[i] + d / (positions[i + 1] - positions[i - 1]) *
+        ((below + d) * (heights[i + 1] - heights[i]) / above +
+         (above - d) * (heights[i] - heights[i - 1]) / below);
+}
+
+double QuantileSketch::linear(int i, int d) const {
+    return heights[i] + d * (heights[i + d] - heights[i]) / (positions[i + d] - positions[i]);
+}
+
+float QuantileSketch::estimate() const {
+    if (samples == 0) {
+        return 0.0f;
+    }
+    if (samples <= Markers) {
+        // Nearest rank over the sorted samples
+        const size_t rank = static_cast<size_t>(quantile * static_cast<double>(samples - 1) + 0.5);
+        return static_cast<float>(heights[rank]);
+    }
+    return static_cast<float>(heights[2]);
+}
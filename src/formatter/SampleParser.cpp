@@ -0,0 +1,117 @@
+#include <charconv>
+#include <cmath>
+#include <iostream>
+#include <system_error>
+#include "formatter/SampleParser.hpp"
+
+namespace {
+    bool isSpace(char c){
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+    }
+
+    bool isLetter(char c){
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    }
+
+    std::string_view trim(std::string_view text){
+        while (!text.empty() && isSpace(text.front())) text.remove_prefix(1);
+        while (!text.empty() && isSpace(text.back()))  text.remove_suffix(1);
+        return text;
+    }
+
+    const char* errorName(SampleParseError_enum error){
+        switch (error) {
+            case SampleParseError_enum::EMPTY:            return "empty";
+            case SampleParseError_enum::NO_NUMBER:        return "no number";
+            case SampleParseError_enum::OUT_OF_RANGE:     return "out of range";
+            case SampleParseError_enum::TRAILING_GARBAGE: return "trailing garbage";
+            default:                                      return "none";
+        }
+    }
+}
+
+std::atomic<uint64_t> SampleParser::errors[SampleParser::ErrorKinds] = {};
+std::atomic<uint64_t> SampleParser::reportedErrors{0};
+std::atomic<int64_t> SampleParser::lastReportNs{0};
+
+SampleParseResult SampleParser::parse(std::string_view text){
+    SampleParseResult result;
+    text = trim(text);
+    if (text.empty()) {
+        result.error = SampleParseError_enum::EMPTY;
+        return result;
+    }
+
+    // "CPU: 12%" -> "12%"
+    if (isLetter(text.front())) {
+        const size_t colon = text.find(':');
+        if (colon == std::string_view::npos) {
+            result.error = SampleParseError_enum::NO_NUMBER;
+            return result;
+        }
+        text = trim(text.substr(colon + 1));
+    }
+
+    // from_chars takes no leading '+'
+    const char* first = text.data();
+    const char* last = text.data() + text.size();
+    if (first != last && *first == '+') {
+        ++first;
+    }
+
+    float value = 0.0f;
+    const std::from_chars_result parsed = std::from_chars(first, last, value);
+    if (parsed.ec == std::errc::result_out_of_range) {
+        result.error = SampleParseError_enum::OUT_OF_RANGE;
+        return result;
+    }
+    if (parsed.ec != std::errc() || !std::isfinite(value)) {
+        result.error = SampleParseError_enum::NO_NUMBER;
+        return result;
+    }
+
+    // Optional unit: "%", "MB", "GB" ...
+    std::string_view rest = trim(std::string_view(parsed.ptr, static_cast<size_t>(last - parsed.ptr)));
+    for (char c : rest) {
+        if (!isLetter(c) && c != '%') {
+            result.error = SampleParseError_enum::TRAILING_GARBAGE;
+            return result;
+        }
+    }
+
+    result.value = value;
+    return result;
+}
+
+void SampleParser::report(SampleParseError_enum error, std::string_view text){
+    errors[static_cast<size_t>(error)].fetch_add(1, std::memory_order_relaxed);
+
+    const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    int64_t last = lastReportNs.load(std::memory_order_relaxed);
+    const int64_t interval = std::chrono::duration_cast<std::chrono::nanoseconds>(ReportInterval).count();
+    if (last != 0 && now - last < interval) {
+        return;
+    }
+    // One thread per interval gets to print
+    if (!lastReportNs.compare_exchange_strong(last, now, std::memory_order_relaxed)) {
+        return;
+    }
+
+    const uint64_t total = errorCount();
+    const uint64_t fresh = total - reportedErrors.exchange(total, std::memory_order_relaxed);
+    std::cerr << "Error: " << fresh << " unparsable telemetry sample(s) since the last report"
+              << " (latest: " << errorName(error) << ", \"" << text.substr(0, 64) << "\")" << std::endl;
+}
+
+uint64_t SampleParser::errorCount(SampleParseError_enum error){
+    return errors[static_cast<size_t>(error)].load(std::memory_order_relaxed);
+}
+
+uint64_t SampleParser::errorCount(){
+    uint64_t total = 0;
+    for (const auto& count : errors) {
+        total += count.load(std::memory_order_relaxed);
+    }
+    return total;
+}
@@ -0,0 +1,162 @@
+#include "formatter/SeverityClassifier.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SEVERITY_CLASSIFIER_X86 1
+#include <immintrin.h>
+#endif
+
+
+namespace {
+
+    static_assert(sizeof(SeverityLvl_enum) == 1, "kernels store one byte per level");
+    static_assert(static_cast<int>(SeverityLvl_enum::CRITICAL) == 0 &&
+                  static_cast<int>(SeverityLvl_enum::WARNING) == 1 &&
+                  static_cast<int>(SeverityLvl_enum::INFO) == 2,
+                  "kernels compute the level as (2 - above warning) & ~above critical");
+
+    SeverityCounts classifyScalar(const float* values, size_t n, float critical, float warning,
+                                  SeverityLvl_enum* out) {
+        SeverityCounts counts;
+        for (size_t i = 0; i < n; ++i) {
+            const bool aboveCritical = values[i] > critical;
+            const bool aboveWarning = !aboveCritical && values[i] > warning;
+            counts.critical += aboveCritical;
+            counts.warning += aboveWarning;
+            if (out) {
+                out[i] = static_cast<SeverityLvl_enum>(2 - aboveWarning - 2 * aboveCritical);
+            }
+        }
+        counts.info = n - counts.critical - counts.warning;
+        return counts;
+    }
+
+#ifdef SEVERITY_CLASSIFIER_X86
+
+    // Set bits of a 4-lane movemask (SSE2 has no popcnt instruction)
+    constexpr uint8_t LaneCount[16] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+
+    // 16 floats per pass: four compares per threshold, levels packed to 16 bytes
+    __attribute__((target("sse2")))
+    SeverityCounts classifySse2(const float* values, size_t n, float critical, float warning,
+                                SeverityLvl_enum* out) {
+        const __m128 criticalVec = _mm_set1_ps(critical);
+        const __m128 warningVec = _mm_set1_ps(warning);
+        const __m128i two = _mm_set1_epi32(2);
+
+        SeverityCounts counts;
+        size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            __m128i levels[4];
+            for (int k = 0; k < 4; ++k) {
+                const __m128 v = _mm_loadu_ps(values + i + 4 * k);
+                const __m128 aboveCritical = _mm_cmpgt_ps(v, criticalVec);
+                const __m128 aboveWarning = _mm_cmpgt_ps(v, warningVec);
+                const int criticalBits = _mm_movemask_ps(aboveCritical);
+                counts.critical += LaneCount[criticalBits];
+                counts.warning += LaneCount[_mm_movemask_ps(aboveWarning) & ~criticalBits];
+                // Masks are -1/0: 2 + (-1) = WARNING, then & ~critical -> CRITICAL (0)
+                levels[k] = _mm_andnot_si128(_mm_castps_si128(aboveCritical),
+                                             _mm_add_epi32(two, _mm_castps_si128(aboveWarning)));
+            }
+            if (out) {
+                const __m128i low = _mm_packs_epi32(levels[0], levels[1]);
+                const __m128i high = _mm_packs_epi32(levels[2], levels[3]);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packs_epi16(low, high));
+            }
+        }
+
+        const SeverityCounts tail = classifyScalar(values + i, n - i, critical, warning, out ? out + i : nullptr);
+        counts.critical += tail.critical;
+        counts.warning += tail.warning;
+        counts.info = n - counts.critical - counts.warning;
+        return counts;
+    }
+
+    // 32 floats per pass; the packs work per 128-bit lane, one permute restores the order
+    __attribute__((target("avx2,popcnt")))
+    SeverityCounts classifyAvx2(const float* values, size_t n, float critical, float warning,
+                                SeverityLvl_enum* out) {
+        const __m256 criticalVec = _mm256_set1_ps(critical);
+        const __m256 warningVec = _mm256_set1_ps(warning);
+        const __m256i two = _mm256_set1_epi32(2);
+        const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+        SeverityCounts counts;
+        size_t i = 0;
+        for (; i + 32 <= n; i += 32) {
+            __m256i levels[4];
+            for (int k = 0; k < 4; ++k) {
+                const __m256 v = _mm256_loadu_ps(values + i + 8 * k);
+                const __m256 aboveCritical = _mm256_cmp_ps(v, criticalVec, _CMP_GT_OQ);
+                const __m256 aboveWarning = _mm256_cmp_ps(v, warningVec, _CMP_GT_OQ);
+                const int criticalBits = _mm256_movemask_ps(aboveCritical);
+                counts.critical += static_cast<size_t>(_mm_popcnt_u32(static_cast<unsigned>(criticalBits)));
+                counts.warning += static_cast<size_t>(_mm_popcnt_u32(
+                    static_cast<unsigned>(_mm256_movemask_ps(aboveWarning) & ~criticalBits)));
+                levels[k] = _mm256_andnot_si256(_mm256_castps_si256(aboveCritical),
+                                                _mm256_add_epi32(two, _mm256_castps_si256(aboveWarning)));
+            }
+            if (out) {
+                const __m256i low = _mm256_packs_epi32(levels[0], levels[1]);
+                const __m256i high = _mm256_packs_epi32(levels[2], levels[3]);
+                const __m256i packed = _mm256_permutevar8x32_epi32(_mm256_packs_epi16(low, high), order);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), packed);
+            }
+        }
+
+        const SeverityCounts tail = classifySse2(values + i, n - i, critical, warning, out ? out + i : nullptr);
+        counts.critical += tail.critical;
+        counts.warning += tail.warning;
+        counts.info = n - counts.critical - counts.warning;
+        return counts;
+    }
+
+#endif
+
+    SimdKernel_enum detectKernel() {
+#ifdef SEVERITY_CLASSIFIER_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+            return SimdKernel_enum::AVX2;
+        }
+        if (__builtin_cpu_supports("sse2")) {
+            return SimdKernel_enum::SSE2;
+        }
+#endif
+        return SimdKernel_enum::SCALAR;
+    }
+
+}
+
+SimdKernel_enum SeverityClassifier::kernel() {
+    static const SimdKernel_enum detected = detectKernel();
+    return detected;
+}
+
+bool SeverityClassifier::supported(SimdKernel_enum kernel) {
+    return static_cast<uint8_t>(kernel) <= static_cast<uint8_t>(SeverityClassifier::kernel());
+}
+
+SeverityCounts SeverityClassifier::classify(const float* values, size_t n,
+                                            float criticalThreshold, float warningThreshold,
+                                            SeverityLvl_enum* out) {
+    return classifyWith(kernel(), values, n, criticalThreshold, warningThreshold, out);
+}
+
+SeverityCounts SeverityClassifier::classifyWith(SimdKernel_enum kernel, const float* values, size_t n,
+                                                float criticalThreshold, float warningThreshold,
+                                                SeverityLvl_enum* out) {
+    if (!supported(kernel)) {
+        kernel = SeverityClassifier::kernel();
+    }
+    switch (kernel) {
+#ifdef SEVERITY_CLASSIFIER_X86
+        case SimdKernel_enum::AVX2:
+            return classifyAvx2(values, n, criticalThreshold, warningThreshold, out);
+        case SimdKernel_enum::SSE2:
+            return classifySse2(values, n, criticalThreshold, warningThreshold, out);
+#endif
+        default:
+            return classifyScalar(values, n, criticalThreshold, warningThreshold, out);
+    }
+}
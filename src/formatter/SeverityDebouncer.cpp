@@ -0,0 +1,78 @@
+#include "formatter/SeverityDebouncer.hpp"
+
+
+namespace {
+
+    // CRITICAL < WARNING < INFO in the enum: a smaller value is more severe
+    bool moreSevere(SeverityLvl_enum a, SeverityLvl_enum b) {
+        return static_cast<uint8_t>(a) < static_cast<uint8_t>(b);
+    }
+
+}
+
+SeverityDebouncer::SeverityDebouncer(float warningThreshold, float criticalThreshold,
+                                     const DebounceConfig& config)
+    : warningThreshold(warningThreshold)
+    , criticalThreshold(criticalThreshold)
+    , config(config) {}
+
+SeverityLvl_enum SeverityDebouncer::target(const LogMessage& message) const {
+    const SeverityLvl_enum raw = message.GetSeverityLevel();
+    if (!moreSevere(current, raw)) {
+        return raw;
+    }
+
+    // Going down: only once the value is clearly below the current level's threshold
+    const std::optional<float> value = message.GetValue();
+    if (!value.has_value()) {
+        return raw;
+    }
+    const float threshold = (current == SeverityLvl_enum::CRITICAL) ? criticalThreshold : warningThreshold;
+    return (*value <= threshold - config.hysteresis) ? raw : current;
+}
+
+bool SeverityDebouncer::admit(LogMessage& message, std::chrono::steady_clock::time_point now) {
+    bool changed = false;
+
+    if (!started) {
+        started = true;
+        current = message.GetSeverityLevel();
+        changed = true;
+    } else {
+        const SeverityLvl_enum next = target(message);
+        if (next == current) {
+            pending = false;
+        } else if (next == SeverityLvl_enum::CRITICAL || config.minDwell.count() == 0) {
+            current = next;
+            changed = true;
+        } else {
+            // The dwell runs while values stay on one side of the current level
+            // (a noisy fall from CRITICAL may alternate WARNING/INFO)
+            if (!pending || moreSevere(candidate, current) != moreSevere(next, current)) {
+                pending = true;
+                candidateSince = now;
+            }
+            candidate = next;
+            if (now - candidateSince >= config.minDwell) {
+                current = next;
+                changed = true;
+            }
+        }
+    }
+
+    const bool heartbeatDue = config.heartbeat.count() > 0 && now - lastAdmitted >= config.heartbeat;
+    if (!changed && !heartbeatDue) {
+        ++suppressed;
+        return false;
+    }
+
+    if (changed) {
+        pending = false;
+    }
+    lastAdmitted = now;
+    if (message.GetSeverityLevel() != current) {
+        message.SetSeverityLevel(current);
+    }
+    ++admitted;
+    return true;
+}
@@ -0,0 +1,106 @@
+#include <algorithm>
+#include "formatter/WindowAggregator.hpp"
+
+
+namespace {
+
+    // Nearest rank on a scratch copy (at most ExactSamples values)
+    float exactQuantile(float* values, size_t n, double quantile) {
+        const size_t rank = static_cast<size_t>(quantile * static_cast<double>(n - 1) + 0.5);
+        std::nth_element(values, values + rank, values + n);
+        return values[rank];
+    }
+
+}
+
+WindowAggregator::WindowAggregator(std::chrono::milliseconds length) : windowLength(length) {}
+
+WindowAggregator::WindowAggregator(std::chrono::milliseconds length,
+                                   float warningThreshold, float criticalThreshold)
+    : windowLength(length),
+      classifying(true),
+      warningThreshold(warningThreshold),
+      criticalThreshold(criticalThreshold) {}
+
+void WindowAggregator::add(float value, std::chrono::steady_clock::time_point now) {
+    if (samples == 0) {
+        opened = now;
+        minimum = value;
+        maximum = value;
+    } else {
+        minimum = std::min(minimum, value);
+        maximum = std::max(maximum, value);
+    }
+    if (samples < ExactSamples) {
+        exact[samples] = value;
+    }
+    ++samples;
+    sum += value;
+    p50.add(value);
+    p95.add(value);
+    p99.add(value);
+
+    if (classifying) {
+        pending[pendingCount++] = value;
+        if (pendingCount == BatchSamples) {
+            classifyPending();
+        }
+    }
+}
+
+void WindowAggregator::classifyPending() {
+    const SeverityCounts block = SeverityClassifier::classify(pending, pendingCount,
+                                                              criticalThreshold, warningThreshold);
+    levels.critical += block.critical;
+    levels.warning += block.warning;
+    levels.info += block.info;
+    pendingCount = 0;
+}
+
+bool WindowAggregator::due(std::chrono::steady_clock::time_point now) const {
+    return samples > 0 && now - opened >= windowLength;
+}
+
+WindowSummary WindowAggregator::summary() const {
+    WindowSummary result;
+    result.length = windowLength;
+    result.count = samples;
+    if (samples == 0) {
+        return result;
+    }
+    result.min = minimum;
+    result.max = maximum;
+    result.mean = static_cast<float>(sum / static_cast<double>(samples));
+
+    if (samples <= ExactSamples) {
+        float scratch[ExactSamples];
+        const size_t n = static_cast<size_t>(samples);
+        std::copy(exact, exact + n, scratch);
+        result.p50 = exactQuantile(scratch, n, 0.50);
+        result.p95 = exactQuantile(scratch, n, 0.95);
+        result.p99 = exactQuantile(scratch, n, 0.99);
+    } else {
+        result.p50 = p50.estimate();
+        result.p95 = p95.estimate();
+        result.p99 = p99.estimate();
+    }
+
+    if (classifying) {
+        const SeverityCounts tail = SeverityClassifier::classify(pending, pendingCount,
+                                                                 criticalThreshold, warningThreshold);
+        result.classified = true;
+        result.warning = levels.warning + tail.warning;
+        result.critical = levels.critical + tail.critical;
+    }
+    return result;
+}
+
+void WindowAggregator::reset() {
+    samples = 0;
+    sum = 0.0;
+    p50.reset();
+    p95.reset();
+    p99.reset();
+    levels = SeverityCounts();
+    pendingCount = 0;
+}
@@ -1,51 +1,406 @@
 #include <algorithm>
 #include "logger/LogManager.hpp"
 
+namespace {
+    SeverityLvl_enum severityOf(const LogMessage &log_message){
+        return log_message.GetSeverityLevel();
+    }
+
+    // SAMPLE policy kicks in once the buffer is this full (3/4)
+    bool aboveHighWatermark(size_t size, size_t capacity){
+        return size * 4 >= capacity * 3;
+    }
+}
+
 // ============================================
 // Constructor
 // ============================================
-LogManager::LogManager(size_t LogBufferCapacity, size_t threadPoolSize)
-    : LogMessagesBuffer{LogBufferCapacity}
+LogManager::LogManager(size_t LogBufferCapacity, size_t threadPoolSize, LogBufferType_enum bufferType)
+    : LogMessagesBuffer{makeBuffer(LogBufferCapacity, bufferType)}
     , stopFlushing{false}
+    , discardPending{false}
+    , workerWaiting{false}
     , threadPool{threadPoolSize}
+    , producersWaiting{0}
+    , sampleCounter{0}
+    , enqueuedCount{0}
+    , droppedCount{}
+    , batchSize{DefaultBatchSize}
+    , dispatchedCount{0}
+    , flushRequested{false}
+    , flushWaiters{0}
 {
     FlushingThread = std::thread(&LogManager::workLoop, this); // Then start thread
 }
 
+LogManager::LogBuffer LogManager::makeBuffer(size_t capacity, LogBufferType_enum bufferType){
+    switch (bufferType) {
+        case LogBufferType_enum::SPSC:
+            return LogBuffer(std::in_place_type<SpscRingBuffer<LogMessage>>, capacity);
+        case LogBufferType_enum::MPMC:
+            return LogBuffer(std::in_place_type<MpmcRingBuffer<LogMessage>>, capacity);
+        default:
+            break;
+    }
+    return LogBuffer(std::in_place_type<RingBuffer<LogMessage>>, capacity);
+}
+
+// ============================================
+// Buffer Access (dispatch on the selected backing store)
+// ============================================
+bool LogManager::bufferPush(const LogMessage &log_message){
+    return std::visit([&log_message](auto& buffer) {
+        return buffer.try_push(log_message);
+    }, LogMessagesBuffer);
+}
+
+std::optional<LogMessage> LogManager::bufferPopUnlessCritical(){
+    return std::visit([](auto& buffer) -> std::optional<LogMessage> {
+        return buffer.try_pop_if([](const LogMessage &oldest) {
+            return severityOf(oldest) != SeverityLvl_enum::CRITICAL;
+        });
+    }, LogMessagesBuffer);
+}
+
+size_t LogManager::bufferDrain(std::vector<LogMessage> &out, size_t max){
+    return std::visit([&out, max](auto& buffer) {
+        return buffer.drain_into(out, max);
+    }, LogMessagesBuffer);
+}
+
+size_t LogManager::bufferPushCount() const{
+    return std::visit([](const auto& buffer) {
+        return buffer.push_count();
+    }, LogMessagesBuffer);
+}
+
+size_t LogManager::bufferPopCount() const{
+    return std::visit([](const auto& buffer) {
+        return buffer.pop_count();
+    }, LogMessagesBuffer);
+}
+
+bool LogManager::bufferEmpty() const{
+    return std::visit([](const auto& buffer) {
+        return buffer.empty();
+    }, LogMessagesBuffer);
+}
+
+bool LogManager::bufferIsSpsc() const{
+    return std::holds_alternative<SpscRingBuffer<LogMessage>>(LogMessagesBuffer);
+}
+
+// Producers only take mx when the worker is (about to be) asleep.
+// Pairs with the fence in workLoop: either we see workerWaiting == true,
+// or the worker's predicate sees what we just pushed.
+void LogManager::wakeWorker(){
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (workerWaiting.load(std::memory_order_relaxed)) {
+        std::lock_guard<std::mutex> lock(mx);
+        cv.notify_one();
+    }
+}
+
+// Worker -> blocked producers, same handshake as wakeWorker()
+void LogManager::notifySpace(){
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (producersWaiting.load(std::memory_order_relaxed) > 0) {
+        std::lock_guard<std::mutex> lock(spaceMx);
+        spaceCv.notify_all();
+    }
+}
+
+// Worker -> flush() waiters. Called between batches: everything that left
+// the buffer so far was either submitted to the strands by this thread or
+// evicted/discarded, so pop_count() is a valid watermark.
+void LogManager::publishDispatched(){
+    dispatchedCount.store(bufferPopCount(), std::memory_order_release);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (flushWaiters.load(std::memory_order_relaxed) > 0) {
+        std::lock_guard<std::mutex> lock(flushMx);
+        flushCv.notify_all();
+    }
+}
+
+// Earliest timed sink flush, if any sink asked for one
+std::optional<std::chrono::steady_clock::time_point> LogManager::nextSinkFlush() const{
+    std::optional<std::chrono::steady_clock::time_point> earliest;
+    for (const auto& entry : SinksBuffer) {
+        if (entry.flushInterval.count() > 0 && (!earliest || entry.nextFlush < *earliest)) {
+            earliest = entry.nextFlush;
+        }
+    }
+    return earliest;
+}
+
+// On the sink's strand, so it never runs next to one of its writes
+void LogManager::flushDueSinks(){
+    const auto now = std::chrono::steady_clock::now();
+    for (auto& entry : SinksBuffer) {
+        if (entry.flushInterval.count() > 0 && now >= entry.nextFlush) {
+            entry.nextFlush = now + entry.flushInterval;
+            entry.strand->submit([sink_ptr = entry.sink.get()] {
+                sink_ptr->flush();
+            });
+        }
+    }
+}
+
 // ============================================
 // Sink Management
 // ============================================
 void LogManager::addSink(ILogSink *SinkPtr){
-    SinksBuffer.push_back(std::unique_ptr<ILogSink>(SinkPtr));
+    const std::chrono::milliseconds interval = SinkPtr->flushInterval();
+    SinksBuffer.push_back(SinkEntry{std::unique_ptr<ILogSink>(SinkPtr),
+                                    std::make_unique<Strand>(threadPool),
+                                    interval,
+                                    std::chrono::steady_clock::now() + interval});
 }
 
 void LogManager::removeSink(ILogSink *SinkPtr){
+    // Let queued writes finish before the sink and its strand go away
+    flush();
     SinksBuffer.erase(
         std::remove_if(SinksBuffer.begin(), 
                        SinksBuffer.end(),
-                       [SinkPtr](const std::unique_ptr<ILogSink>& ptr) { 
-                           return ptr.get() == SinkPtr; 
+                       [SinkPtr](const SinkEntry& entry) { 
+                           return entry.sink.get() == SinkPtr; 
                        }),
         SinksBuffer.end());
 }
 
 void LogManager::DeleteAllSinks(){
+    flush();
     SinksBuffer.clear();
 }
 
 void LogManager::DeleteAllLogMessages(){
-    LogMessagesBuffer.clear();
+    if (bufferIsSpsc()) {
+        // Only the worker may consume from an SPSC buffer: let it do the clearing
+        discardPending = true;
+        wakeWorker();
+        return;
+    }
+    std::lock_guard<std::mutex> lock(consumerMx);
+    std::visit([](auto& buffer) { buffer.clear(); }, LogMessagesBuffer);
+}
+
+// ============================================
+// Batching
+// ============================================
+void LogManager::setBatchSize(size_t size){
+    batchSize.store(size == 0 ? 1 : size, std::memory_order_relaxed);
+}
+
+size_t LogManager::getBatchSize() const{
+    return batchSize.load(std::memory_order_relaxed);
+}
+
+// ============================================
+// Overflow Policy & Statistics
+// ============================================
+void LogManager::setOverflowPolicy(const LogOverflowConfig &config){
+    overflowConfig = config;
+    if (overflowConfig.sampleEvery == 0) {
+        overflowConfig.sampleEvery = 1;
+    }
+}
+
+const LogOverflowConfig& LogManager::getOverflowPolicy() const{
+    return overflowConfig;
+}
+
+uint64_t LogManager::getEnqueuedCount() const{
+    return enqueuedCount.load(std::memory_order_relaxed);
+}
+
+uint64_t LogManager::getDroppedCount() const{
+    uint64_t total = 0;
+    for (const auto& counter : droppedCount) {
+        total += counter.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+uint64_t LogManager::getDroppedCount(SeverityLvl_enum severity) const{
+    return droppedCount[static_cast<size_t>(severity)].load(std::memory_order_relaxed);
+}
+
+void LogManager::countDrop(SeverityLvl_enum severity){
+    droppedCount[static_cast<size_t>(severity)].fetch_add(1, std::memory_order_relaxed);
 }
 
 // ============================================
 // Logging (Called by Main Thread)
 // ============================================
-void LogManager::log(const LogMessage &log_message){
+bool LogManager::pushSerialized(const LogMessage &log_message){
+    if (bufferIsSpsc()) {
+        // SPSC needs producers serialized; MUTEX and MPMC buffers are safe as-is
+        std::lock_guard<std::mutex> lock(producerMx);
+        return bufferPush(log_message);
+    }
+    return bufferPush(log_message);
+}
+
+// Waits for the worker to free a slot. No deadline = wait until pushed
+// (used for CRITICAL). Gives up only if the manager is shutting down.
+bool LogManager::pushBlocking(const LogMessage &log_message,
+                              std::optional<std::chrono::steady_clock::time_point> deadline){
+    std::unique_lock<std::mutex> lock(spaceMx);
+    producersWaiting.fetch_add(1, std::memory_order_seq_cst);
+
+    bool pushed = false;
+    while (!(pushed = pushSerialized(log_message)) && !stopFlushing.load()) {
+        if (deadline.has_value()) {
+            if (spaceCv.wait_until(lock, *deadline) == std::cv_status::timeout) {
+                pushed = pushSerialized(log_message);
+                break;
+            }
+        } else {
+            spaceCv.wait(lock);
+        }
+    }
+
+    producersWaiting.fetch_sub(1, std::memory_order_relaxed);
+    return pushed;
+}
+
+// Overwrite mode: evict the oldest message to make room. A CRITICAL message
+// is never evicted: when it is the oldest, the incoming message is dropped
+// instead (this path never sees CRITICAL, log() waits for those).
+bool LogManager::pushEvictingOldest(const LogMessage &log_message){
+    for (int attempt = 0; attempt < 4; ++attempt) {
+        std::optional<LogMessage> victim;
+        {
+            std::lock_guard<std::mutex> lock(consumerMx);
+            victim = bufferPopUnlessCritical();
+        }
+        if (victim.has_value()) {
+            notifySpace();
+            countDrop(severityOf(*victim));
+        }
+        if (pushSerialized(log_message)) {
+            return true;
+        }
+        if (!victim.has_value()) {
+            return false;
+        }
+    }
+    return false;
+}
+
+bool LogManager::admitSample(){
+    size_t size = std::visit([](const auto& buffer) { return buffer.size(); }, LogMessagesBuffer);
+    size_t capacity = std::visit([](const auto& buffer) { return buffer.capacity(); }, LogMessagesBuffer);
+    if (!aboveHighWatermark(size, capacity)) {
+        return true;
+    }
+    return sampleCounter.fetch_add(1, std::memory_order_relaxed) % overflowConfig.sampleEvery == 0;
+}
+
+bool LogManager::log(const LogMessage &log_message){
+    const SeverityLvl_enum severity = severityOf(log_message);
+    bool queued = false;
+
+    if (severity == SeverityLvl_enum::CRITICAL) {
+        // Never dropped: wait for space regardless of the policy
+        queued = pushSerialized(log_message) || pushBlocking(log_message, std::nullopt);
+    } else {
+        switch (overflowConfig.policy) {
+            case LogOverflowPolicy_enum::BLOCK:
+                queued = pushSerialized(log_message) ||
+                         pushBlocking(log_message,
+                                      std::chrono::steady_clock::now() + overflowConfig.blockTimeout);
+                break;
+
+            case LogOverflowPolicy_enum::DROP_OLDEST:
+                // Evicting means consuming: impossible from a producer in SPSC mode
+                queued = pushSerialized(log_message) ||
+                         (!bufferIsSpsc() && pushEvictingOldest(log_message));
+                break;
+
+            case LogOverflowPolicy_enum::SAMPLE:
+                queued = admitSample() && pushSerialized(log_message);
+                break;
+
+            case LogOverflowPolicy_enum::DROP_NEWEST:
+            default:
+                queued = pushSerialized(log_message);
+                break;
+        }
+    }
+
+    if (queued) {
+        enqueuedCount.fetch_add(1, std::memory_order_relaxed);
+        wakeWorker();
+    } else {
+        countDrop(severity);
+    }
+    return queued;
+}
+
+// ============================================
+// Flush (Called by Any Thread)
+// ============================================
+void LogManager::flush(){
+    flushUntil(std::nullopt);
+}
+
+bool LogManager::flush_for(std::chrono::milliseconds timeout){
+    return flushUntil(std::chrono::steady_clock::now() + timeout);
+}
+
+bool LogManager::flushUntil(std::optional<std::chrono::steady_clock::time_point> deadline){
+    // Buffer position of the last message logged before this call
+    const uint64_t target = bufferPushCount();
+
+    // 1. Wait until the worker has handed everything up to 'target' to the strands
     {
-        std::lock_guard<std::mutex> lock(mx);   // Simpler than unique_lock here
-        LogMessagesBuffer.try_push(std::move(log_message));
+        std::unique_lock<std::mutex> lock(flushMx);
+        flushWaiters.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        bool reached = true;
+        while (dispatchedCount.load(std::memory_order_acquire) < target) {
+            // An idle worker has nothing to drain: ask it to publish anyway
+            flushRequested.store(true);
+            wakeWorker();
+            if (!deadline.has_value()) {
+                flushCv.wait(lock);
+            } else if (flushCv.wait_until(lock, *deadline) == std::cv_status::timeout) {
+                reached = dispatchedCount.load(std::memory_order_acquire) >= target;
+                break;
+            }
+        }
+
+        flushWaiters.fetch_sub(1, std::memory_order_relaxed);
+        if (!reached) {
+            return false;
+        }
     }
-    cv.notify_one();
+
+    // 2. A strand runs its tasks in order: once this flush task has run on
+    //    a sink, every batch submitted to it before has been written too
+    std::vector<Completion> flushed;
+    flushed.reserve(SinksBuffer.size());
+    for (auto& entry : SinksBuffer) {
+        flushed.push_back(entry.strand->submit(ThreadPool::track, [sink_ptr = entry.sink.get()] {
+            sink_ptr->flush();
+        }));
+    }
+
+    for (const auto& done : flushed) {
+        if (!deadline.has_value()) {
+            done.wait();
+            continue;
+        }
+        auto remaining = std::chrono::ceil<std::chrono::milliseconds>(
+            *deadline - std::chrono::steady_clock::now());
+        if (remaining.count() < 0 || !done.wait_for(remaining)) {
+            return false;
+        }
+    }
+    return true;
 }
 
 // ============================================
@@ -53,31 +408,72 @@ void LogManager::log(const LogMessage &log_message){
 // ============================================
 void LogManager::workLoop(){
     while (true) {
-        std::unique_lock<std::mutex> lock(mx);
-        
-        // Wait until: have data OR stopping
-        cv.wait(lock, [this]{ 
-            return stopFlushing.load() || !LogMessagesBuffer.empty(); 
-        });
-        
-        // Exit condition: stopping AND buffer empty
-        if (stopFlushing.load() && LogMessagesBuffer.empty()) {
-            return;  // Exit the loop and end thread
+        {
+            std::unique_lock<std::mutex> lock(mx);
+
+            // Announce we may sleep BEFORE re-checking the buffer (see wakeWorker)
+            workerWaiting.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            
+            // Wait until: have data OR stopping OR a sink's timed flush is due
+            auto ready = [this]{ 
+                return stopFlushing.load() || discardPending.load() ||
+                       flushRequested.load() || !bufferEmpty(); 
+            };
+            if (const auto flushAt = nextSinkFlush()) {
+                cv.wait_until(lock, *flushAt, ready);
+            } else {
+                cv.wait(lock, ready);
+            }
+            workerWaiting.store(false, std::memory_order_relaxed);
+            
+            // Exit condition: stopping AND buffer empty
+            if (stopFlushing.load() && bufferEmpty()) {
+                publishDispatched();
+                return;  // Exit the loop and end thread
+            }
+        }   // Unlock before processing (so main thread can push more)
+
+        flushRequested.store(false);
+
+        if (discardPending.exchange(false)) {
+            {
+                std::lock_guard<std::mutex> lock(consumerMx);
+                std::visit([](auto& buffer) { buffer.clear(); }, LogMessagesBuffer);
+            }
+            notifySpace();
+            publishDispatched();
+            continue;
         }
         
-        // Unlock before processing (so main thread can push more)
-        lock.unlock();
-        
-        // Pop and write ONE message
-        auto msg = LogMessagesBuffer.try_pop();
-        if (msg.has_value()) {
-            for (auto& sink_ptr : SinksBuffer) {
-                // the arguments are copied here, but that's fine since LogMessage is small and we want to avoid dangling references
-                threadPool.submit([sink_ptr = sink_ptr.get(), msg = *msg] {
-                    sink_ptr->write(msg);
+        // Drain everything available, up to batchSize per pass, before sleeping again
+        while (!discardPending.load()) {
+            const size_t maxBatch = batchSize.load(std::memory_order_relaxed);
+            auto batch = std::make_shared<std::vector<LogMessage>>();
+            batch->reserve(maxBatch);
+            size_t drained;
+            {
+                std::lock_guard<std::mutex> lock(consumerMx);
+                drained = bufferDrain(*batch, maxBatch);
+            }
+            if (drained == 0) {
+                break;
+            }
+            notifySpace();
+
+            // ONE task per sink per batch, queued on the sink's strand so the
+            // same sink never runs two batches at once or out of order.
+            // All sinks share the same immutable batch.
+            std::shared_ptr<const std::vector<LogMessage>> shared = std::move(batch);
+            for (auto& entry : SinksBuffer) {
+                entry.strand->submit([sink_ptr = entry.sink.get(), shared] {
+                    sink_ptr->writeBatch(shared->data(), shared->size());
                 });
             }
         }
+
+        flushDueSinks();
+        publishDispatched();
     }
 }
 
@@ -85,18 +481,24 @@ void LogManager::workLoop(){
 // Destructor
 // ============================================
 LogManager::~LogManager(){
+    // Everything logged so far reaches the sinks (and their flush())
+    // while the worker, pool and sinks are all still alive
+    flush();
+
     // Signal worker to stop
     {
         std::lock_guard<std::mutex> lock(mx);
         stopFlushing = true;
     }
     cv.notify_all();
+    notifySpace();
     
     // Wait for worker to finish
     if (FlushingThread.joinable()) {
         FlushingThread.join();
     }
-    
-    // Clean up
-    SinksBuffer.clear();
+
+    // Sinks and their strands are destroyed after threadPool (member order),
+    // i.e. only once the pool has run every queued sink task (there are
+    // none left after flush() unless a producer was still logging)
 }
\ No newline at end of file
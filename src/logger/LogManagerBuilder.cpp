@@ -1,29 +1,52 @@
 #include "logger/LogManagerBuilder.hpp"
 
+void LogManagerBuilder::ensureLogManager() {
+    if (!PtrToLogManager) {
+        PtrToLogManager = std::make_unique<LogManager>(bufferSize_, threadPoolSize_, bufferType_);
+        PtrToLogManager->setOverflowPolicy(overflowConfig_);
+        PtrToLogManager->setBatchSize(batchSize_);
+    }
+}
+
 LogManagerBuilder& LogManagerBuilder::setBufferSize(size_t size) {
     bufferSize_ = size;
     return *this;
 }
 
-LogManagerBuilder& LogManagerBuilder::addSink(ILogSink* SinkPtr) {
-    if (!PtrToLogManager) {
-        PtrToLogManager = std::make_unique<LogManager>(bufferSize_);
+LogManagerBuilder& LogManagerBuilder::setBufferType(LogBufferType_enum type) {
+    bufferType_ = type;
+    return *this;
+}
+
+LogManagerBuilder& LogManagerBuilder::setOverflowPolicy(const LogOverflowConfig& config) {
+    overflowConfig_ = config;
+    if (PtrToLogManager) {
+        PtrToLogManager->setOverflowPolicy(overflowConfig_);
+    }
+    return *this;
+}
+
+LogManagerBuilder& LogManagerBuilder::setBatchSize(size_t size) {
+    batchSize_ = size;
+    if (PtrToLogManager) {
+        PtrToLogManager->setBatchSize(batchSize_);
     }
+    return *this;
+}
+
+LogManagerBuilder& LogManagerBuilder::addSink(ILogSink* SinkPtr) {
+    ensureLogManager();
     PtrToLogManager->addSink(SinkPtr);
     return *this;
 }
 
 LogManagerBuilder& LogManagerBuilder::addLogMessage(LogMessage& LogMessageRef) {
-    if (!PtrToLogManager) {
-        PtrToLogManager = std::make_unique<LogManager>(bufferSize_);
-    }
+    ensureLogManager();
     PtrToLogManager->log(LogMessageRef);
     return *this;
 }
 
 std::unique_ptr<LogManager> LogManagerBuilder::build() {
-    if (!PtrToLogManager) {
-        PtrToLogManager = std::make_unique<LogManager>(bufferSize_);
-    }
+    ensureLogManager();
     return std::move(PtrToLogManager);
-}
\ No newline at end of file
+}
@@ -1,23 +1,463 @@
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <iostream>
+#include "formatter/PolicyText.hpp"
+#include "logger/LogMessage.hpp"
 
+namespace {
+    std::atomic<uint64_t> truncatedMessages{0};
 
+    SeverityLvl_enum parseSeverity(std::string_view severity){
+        if (severity == "CRITICAL") return SeverityLvl_enum::CRITICAL;
+        if (severity == "WARNING")  return SeverityLvl_enum::WARNING;
+        return SeverityLvl_enum::INFO;
+    }
 
-#include "logger/LogMessage.hpp"
+    // Stores 'value' in an empty slot; if another thread got there first, keeps theirs
+    const std::string* installOnce(std::atomic<const std::string*>& slot, std::string&& value){
+        auto* fresh = new std::string(std::move(value));
+        const std::string* expected = nullptr;
+        if (slot.compare_exchange_strong(expected, fresh,
+                                         std::memory_order_acq_rel,
+                                         std::memory_order_acquire)) {
+            return fresh;
+        }
+        delete fresh;
+        return expected;
+    }
+
+    void appendJsonString(std::string &out, std::string_view text){
+        static const char hex[] = "0123456789abcdef";
+        out += '"';
+        for (char c : text) {
+            switch (c) {
+                case '"':  out += "\\\""; break;
+                case '\\': out += "\\\\"; break;
+                case '\n': out += "\\n"; break;
+                case '\r': out += "\\r"; break;
+                case '\t': out += "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        out += "\\u00";
+                        out += hex[(c >> 4) & 0xF];
+                        out += hex[c & 0xF];
+                    } else {
+                        out += c;
+                    }
+            }
+        }
+        out += '"';
+    }
+}
+
+// One slot per LogFormat_enum, plus the lazily rendered message text
+struct LogMessage::RenderCache {
+    static constexpr size_t FormatCount = 2;
 
+    std::atomic<const std::string*> message{nullptr};
+    std::atomic<const std::string*> lines[FormatCount];
+
+    RenderCache(){
+        for (auto& line : lines) {
+            line.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ~RenderCache(){
+        delete message.load(std::memory_order_relaxed);
+        for (auto& line : lines) {
+            delete line.load(std::memory_order_relaxed);
+        }
+    }
+};
+
+// ============================================
+// Constructors
+// ============================================
 LogMessage::LogMessage(const std::string& appName,
                        const std::string& context,
                        const std::string& severity,
                        const std::string& time,
                        const std::string& message)
-                     : appName(appName),
-                       context(context),
+                     : timestampNs(0),
+                       appId(StringInterner::instance().intern(appName)),
+                       contextId(StringInterner::instance().intern(context)),
+                       severityLabelId(0),
+                       textSize(0),
+                       severity(parseSeverity(severity)),
+                       flags(0),
+                       rawTimeSize(0),
+                       cache(nullptr) {
+    if (severity != severityName(this->severity)) {
+        severityLabelId = StringInterner::instance().intern(severity);
+    }
+
+    if (Timestamp::parse(time, timestampNs)) {
+        flags |= WholeSecond;
+        assignText(message);
+    } else {
+        // Not our format: keep the string as given
+        std::string_view rawTime(time.data(), std::min<size_t>(time.size(), UINT8_MAX));
+        rawTimeSize = static_cast<uint8_t>(rawTime.size());
+        flags |= RawTime;
+        assignText(rawTime, message);
+    }
+}
+
+LogMessage::LogMessage(StringInterner::Id appId,
+                       StringInterner::Id contextId,
+                       SeverityLvl_enum severity,
+                       int64_t timestampNs,
+                       std::string_view message)
+                     : timestampNs(timestampNs),
+                       appId(appId),
+                       contextId(contextId),
+                       severityLabelId(0),
+                       textSize(0),
                        severity(severity),
-                       time(time),
-                       message(message) {}
+                       flags(0),
+                       rawTimeSize(0),
+                       cache(nullptr) {
+    assignText(message);
+}
+
+LogMessage::LogMessage(StringInterner::Id appId,
+                       TelemetrySrc_enum context,
+                       SeverityLvl_enum severity,
+                       int64_t timestampNs,
+                       std::string_view message)
+                     : LogMessage(appId, contextIdOf(context), severity, timestampNs, message) {}
+
+LogMessage::LogMessage(StringInterner::Id appId,
+                       TelemetrySrc_enum context,
+                       SeverityLvl_enum severity,
+                       int64_t timestampNs,
+                       float value,
+                       const SampleFormat& format)
+                     : LogMessage(appId, contextIdOf(context), severity, timestampNs, value, format) {}
+
+LogMessage::LogMessage(StringInterner::Id appId,
+                       StringInterner::Id contextId,
+                       SeverityLvl_enum severity,
+                       int64_t timestampNs,
+                       float value,
+                       const SampleFormat& format)
+                     : timestampNs(timestampNs),
+                       appId(appId),
+                       contextId(contextId),
+                       severityLabelId(0),
+                       textSize(0),
+                       severity(severity),
+                       flags(Lazy),
+                       rawTimeSize(0),
+                       cache(nullptr) {
+    const LazySample sample{value, format};
+    std::memcpy(text, &sample, sizeof(sample));
+}
+
+LogMessage::LogMessage(const LogMessage& other) : flags(0), cache(nullptr) {
+    copyFrom(other);
+}
+
+LogMessage& LogMessage::operator =(const LogMessage& other){
+    if (this != &other) {
+        releaseText();
+        copyFrom(other);
+    }
+    return *this;
+}
+
+LogMessage::LogMessage(LogMessage&& other) noexcept {
+    moveFrom(other);
+}
+
+LogMessage& LogMessage::operator =(LogMessage&& other) noexcept{
+    if (this != &other) {
+        releaseText();
+        moveFrom(other);
+    }
+    return *this;
+}
+
+LogMessage::~LogMessage(){
+    releaseText();
+}
+
+// ============================================
+// Text Storage
+// ============================================
+const char* LogMessage::textData() const{
+    if (flags & HeapText) {
+        const char* heap;
+        std::memcpy(&heap, text, sizeof(heap));
+        return heap;
+    }
+    return text;
+}
+
+void LogMessage::assignText(std::string_view first, std::string_view second){
+    size_t size = first.size() + second.size();
+    if (size > UINT16_MAX) {
+        // Reported at the 1st, 2nd, 4th, 8th... cut message, so a flood stays readable
+        const uint64_t count = truncatedMessages.fetch_add(1, std::memory_order_relaxed) + 1;
+        if ((count & (count - 1)) == 0) {
+            std::cerr << "Error: log message of " << size << " bytes cut to " << UINT16_MAX
+                      << " (" << count << " cut so far)" << std::endl;
+        }
+        size = UINT16_MAX;
+        first = first.substr(0, size);
+        second = second.substr(0, size - first.size());
+    }
+    textSize = static_cast<uint16_t>(size);
+
+    char* dest = text;
+    if (size > InlineTextSize) {
+        dest = new char[size];
+        std::memcpy(text, &dest, sizeof(dest));
+        flags |= HeapText;
+    }
+    if (!first.empty()) {
+        std::memcpy(dest, first.data(), first.size());
+    }
+    if (!second.empty()) {
+        std::memcpy(dest + first.size(), second.data(), second.size());
+    }
+}
+
+void LogMessage::releaseText(){
+    if (flags & HeapText) {
+        delete[] textData();
+        flags &= static_cast<uint8_t>(~HeapText);
+    }
+    delete cache.exchange(nullptr, std::memory_order_acquire);
+}
+
+void LogMessage::copyFrom(const LogMessage& other){
+    timestampNs = other.timestampNs;
+    appId = other.appId;
+    contextId = other.contextId;
+    severityLabelId = other.severityLabelId;
+    severity = other.severity;
+    flags = static_cast<uint8_t>(other.flags & ~HeapText);
+    rawTimeSize = other.rawTimeSize;
+    if (other.flags & Lazy) {
+        // The copy renders (and caches) its own text if it is ever asked for
+        textSize = 0;
+        std::memcpy(text, other.text, sizeof(LazySample));
+        return;
+    }
+    assignText(std::string_view(other.textData(), other.textSize));
+}
+
+void LogMessage::moveFrom(LogMessage& other){
+    // Heap text (its pointer is in 'text') and the render cache change owner
+    timestampNs = other.timestampNs;
+    appId = other.appId;
+    contextId = other.contextId;
+    severityLabelId = other.severityLabelId;
+    textSize = other.textSize;
+    severity = other.severity;
+    flags = other.flags;
+    rawTimeSize = other.rawTimeSize;
+    std::memcpy(text, other.text, sizeof(text));
+    cache.store(other.cache.exchange(nullptr, std::memory_order_relaxed), std::memory_order_relaxed);
+
+    other.flags &= static_cast<uint8_t>(~HeapText);
+    other.textSize = 0;
+    other.rawTimeSize = 0;
+}
+
+LogMessage::LazySample LogMessage::lazySample() const{
+    LazySample sample;
+    std::memcpy(&sample, text, sizeof(sample));
+    return sample;
+}
+
+LogMessage::RenderCache& LogMessage::renderCache() const{
+    RenderCache* current = cache.load(std::memory_order_acquire);
+    if (current != nullptr) {
+        return *current;
+    }
+
+    // Sinks on other threads may render the same message: first one wins
+    auto* fresh = new RenderCache();
+    RenderCache* expected = nullptr;
+    if (cache.compare_exchange_strong(expected, fresh,
+                                      std::memory_order_acq_rel,
+                                      std::memory_order_acquire)) {
+        return *fresh;
+    }
+    delete fresh;
+    return *expected;
+}
+
+// ============================================
+// Rendering
+// ============================================
+const std::string& LogMessage::Render(LogFormat_enum format) const{
+    std::atomic<const std::string*>& slot = renderCache().lines[static_cast<size_t>(format)];
+    const std::string* line = slot.load(std::memory_order_acquire);
+    if (line != nullptr) {
+        return *line;
+    }
+    return *installOnce(slot, format == LogFormat_enum::JSON ? renderJson() : renderText());
+}
+
+std::string LogMessage::renderText() const{
+    char timeBuffer[Timestamp::MaxLength];
+    const std::string_view time = timeText(timeBuffer);
+    const std::string& severityText = GetSeverity();
+    const std::string& app = GetAppName();
+    const std::string& context = GetContext();
+
+    // The line is the only allocation: it becomes the cached copy
+    std::string line;
+    line.reserve(time.size() + severityText.size() + app.size() + context.size() + textSize + 96);
+    line += '[';
+    line += time;
+    line += "] <";
+    line += severityText;
+    line += "> ";
+    if ((flags & Lazy) && lazySample().format.sourcePrefix != 0) {
+        line += StringInterner::instance().lookup(lazySample().format.sourcePrefix);
+    } else {
+        line += '(';
+        line += app;
+        line += " - ";
+        line += context;
+        line += ')';
+    }
+    line += " : ";
+    if (flags & Lazy) {
+        appendLazyMessage(line);
+    } else {
+        line += GetMessage();
+    }
+    return line;
+}
+
+std::string LogMessage::renderJson() const{
+    std::string line;
+    line.reserve(96 + textSize);
+    char timeBuffer[Timestamp::MaxLength];
+    line += "{\"time\":";
+    appendJsonString(line, timeText(timeBuffer));
+    line += ",\"timestampNs\":";
+    line += std::to_string(timestampNs);
+    line += ",\"severity\":";
+    appendJsonString(line, GetSeverity());
+    line += ",\"app\":";
+    appendJsonString(line, GetAppName());
+    line += ",\"context\":";
+    appendJsonString(line, GetContext());
+    line += ",\"message\":";
+    appendJsonString(line, GetMessage());
+    line += '}';
+    return line;
+}
+
+void LogMessage::appendLazyMessage(std::string& out) const{
+    const LazySample sample = lazySample();
+    const StringInterner& interner = StringInterner::instance();
+    const std::string& unit = interner.lookup(sample.format.unit);
+    if (sample.format.bodyPrefix != 0) {
+        SampleText::AppendBody(out, interner.lookup(sample.format.bodyPrefix), sample.value, unit);
+    } else {
+        out += GetContext();
+        SampleText::AppendBody(out, "usage : ", sample.value, unit);
+    }
+}
+
+// ============================================
+// Accessors
+// ============================================
+std::string LogMessage::ToString() const{
+    return Render(LogFormat_enum::TEXT);
+}
+
+const std::string& LogMessage::GetAppName() const{
+    return StringInterner::instance().lookup(appId);
+}
 
-std::string LogMessage::ToString(){
-    return "[" + time + "] " + "<" + severity + "> " + "(" + appName + " - " + context + ") : " + message;
+const std::string& LogMessage::GetContext() const{
+    return StringInterner::instance().lookup(contextId);
 }
 
+const std::string& LogMessage::GetSeverity() const{
+    if (severityLabelId != 0) {
+        return StringInterner::instance().lookup(severityLabelId);
+    }
+    return severityName(severity);
+}
+
+SeverityLvl_enum LogMessage::GetSeverityLevel() const{
+    return severity;
+}
+
+void LogMessage::SetSeverityLevel(SeverityLvl_enum level){
+    severity = level;
+    severityLabelId = 0;
+    delete cache.exchange(nullptr, std::memory_order_acquire);
+}
 
+int64_t LogMessage::GetTimestampNs() const{
+    return timestampNs;
+}
+
+std::string LogMessage::GetTime() const{
+    char buffer[Timestamp::MaxLength];
+    return std::string(timeText(buffer));
+}
+
+std::string_view LogMessage::timeText(char (&buffer)[Timestamp::MaxLength]) const{
+    if (flags & RawTime) {
+        return std::string_view(textData(), rawTimeSize);
+    }
+    const auto precision = (flags & WholeSecond) ? Timestamp::Precision::Seconds
+                                                 : Timestamp::Precision::Millis;
+    return std::string_view(buffer, Timestamp::format(timestampNs, buffer, precision));
+}
 
-                       
\ No newline at end of file
+std::string_view LogMessage::GetMessage() const{
+    if (flags & Lazy) {
+        std::atomic<const std::string*>& slot = renderCache().message;
+        const std::string* rendered = slot.load(std::memory_order_acquire);
+        if (rendered == nullptr) {
+            std::string message;
+            message.reserve(64);
+            appendLazyMessage(message);
+            rendered = installOnce(slot, std::move(message));
+        }
+        return *rendered;
+    }
+    return std::string_view(textData() + rawTimeSize, textSize - rawTimeSize);
+}
+
+std::optional<float> LogMessage::GetValue() const{
+    if (flags & Lazy) {
+        return lazySample().value;
+    }
+    return std::nullopt;
+}
+
+uint64_t LogMessage::truncatedCount(){
+    return truncatedMessages.load(std::memory_order_relaxed);
+}
+
+// ============================================
+// Shared Name Tables
+// ============================================
+StringInterner::Id LogMessage::contextIdOf(TelemetrySrc_enum context){
+    static const std::array<StringInterner::Id, 3> ids{
+        StringInterner::instance().intern("CPU"),
+        StringInterner::instance().intern("GPU"),
+        StringInterner::instance().intern("RAM")
+    };
+    return ids[static_cast<size_t>(context)];
+}
+
+const std::string& LogMessage::severityName(SeverityLvl_enum severity){
+    static const std::array<std::string, 3> names{"CRITICAL", "WARNING", "INFO"};
+    return names[static_cast<size_t>(severity)];
+}
@@ -0,0 +1,52 @@
+#include <iostream>
+#include "logger/StringInterner.hpp"
+
+StringInterner& StringInterner::instance(){
+    static StringInterner interner;
+    return interner;
+}
+
+StringInterner::StringInterner() : count(0), overflowId(0), overflowReported(false) {
+    for (auto& slot : slots) {
+        slot.store(nullptr, std::memory_order_relaxed);
+    }
+    std::lock_guard<std::mutex> lock(mx);
+    insertLocked("");
+    overflowId = insertLocked("?");
+}
+
+StringInterner::Id StringInterner::insertLocked(std::string_view text){
+    auto it = ids.find(text);
+    if (it != ids.end()) {
+        return it->second;
+    }
+
+    if (count == MaxStrings) {
+        if (!overflowReported) {
+            std::cerr << "Error: StringInterner is full (" << MaxStrings
+                      << " strings), new names are logged as \"?\"" << std::endl;
+            overflowReported = true;
+        }
+        return overflowId;
+    }
+
+    const Id id = static_cast<Id>(count++);
+    owned[id] = std::make_unique<const std::string>(text);
+    ids.emplace(std::string_view(*owned[id]), id);
+    slots[id].store(owned[id].get(), std::memory_order_release);
+    return id;
+}
+
+StringInterner::Id StringInterner::intern(std::string_view text){
+    std::lock_guard<std::mutex> lock(mx);
+    return insertLocked(text);
+}
+
+const std::string& StringInterner::lookup(Id id) const{
+    const std::string* text = (id < MaxStrings) ? slots[id].load(std::memory_order_acquire) : nullptr;
+    if (text == nullptr) {
+        // Never handed out by intern(): treat as empty
+        return *slots[0].load(std::memory_order_acquire);
+    }
+    return *text;
+}
@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+#include "raii/LineReader.hpp"
+
+
+LineReader::LineReader(size_t capacity)
+    : size(std::min(std::max(capacity, MinCapacity), MaxCapacity)) {
+    buffer.reset(new char[size]);
+}
+
+bool LineReader::bufferedLine(std::string_view& line) {
+    if (begin == end) {
+        return false;
+    }
+    const char* start = buffer.get() + begin;
+    const char* newline = static_cast<const char*>(std::memchr(start, '\n', end - begin));
+    if (newline == nullptr) {
+        return false;
+    }
+    line = std::string_view(start, static_cast<size_t>(newline - start));
+    begin += line.size() + 1;
+    return true;
+}
+
+bool LineReader::oversizedLine(std::string_view& line) {
+    if (begin != 0 || end != size) {
+        return false;
+    }
+    line = std::string_view(buffer.get(), size);
+    begin = end;
+    return true;
+}
+
+void LineReader::compact() {
+    if (begin == 0) {
+        return;
+    }
+    const size_t pending = end - begin;
+    if (pending > 0) {
+        std::memmove(buffer.get(), buffer.get() + begin, pending);
+    }
+    begin = 0;
+    end = pending;
+}
+
+ssize_t LineReader::fill(int fd) {
+    if (end == size || begin == end) {
+        compact();
+    }
+    if (end == size) {
+        return 0;
+    }
+
+    ssize_t received;
+    do {
+        ++reads;
+        received = read(fd, buffer.get() + end, size - end);
+    } while (received < 0 && errno == EINTR);
+
+    if (received > 0) {
+        end += static_cast<size_t>(received);
+    } else if (received == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+        ended = true;
+    }
+    return received;
+}
+
+bool LineReader::readLine(int fd, std::string_view& line) {
+    while (!bufferedLine(line)) {
+        if (oversizedLine(line)) {
+            return true;
+        }
+
+        const ssize_t received = fill(fd);
+        if (received > 0) {
+            continue;
+        }
+        // End of file: what is left is the last line
+        if (received == 0 && begin != end) {
+            line = std::string_view(buffer.get() + begin, end - begin);
+            begin = end;
+            return true;
+        }
+        return false;
+    }
+    return true;
+}
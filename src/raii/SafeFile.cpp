@@ -14,20 +14,28 @@ bool SafeFile::IsOpen(){
     return(fd!=FAILED_TO_OPEN);
 }
 
+int SafeFile::Fd() const{
+    return(fd);
+}
+
 std::string SafeFile::Read(){
-    std::string returnString;
-    if(fd != FAILED_TO_OPEN){
-        char ch;
-    
-        // Read one character at a time until newline or EOF
-        while (read(fd, &ch, 1) == 1) {
-            if (ch == '\n') {
-                break;
-            }
-            returnString += ch;
-        }
+    std::string_view line;
+    if(ReadLine(line)){
+        return std::string(line);
+    }
+    return std::string();
+}
+
+bool SafeFile::ReadLine(std::string_view &line){
+    if(fd == FAILED_TO_OPEN){
+        return false;
     }
-    return(returnString);
+    // Buffered: one read() brings in every queued line, not one byte
+    return Reader.readLine(fd, line);
+}
+
+bool SafeFile::AtEnd() const{
+    return(Reader.atEnd() && Reader.buffered() == 0);
 }
 
 SafeFile::~SafeFile(){
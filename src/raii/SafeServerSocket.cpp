@@ -0,0 +1,60 @@
+#include <sys/types.h>          
+#include <sys/socket.h>
+#include"raii/SafeServerSocket.hpp"
+#include <cerrno>
+#include <cstring>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+
+constexpr int FAILED_TO_OPEN = -1;
+
+
+SafeServerSocket::SafeServerSocket(std::string &RefFilePath, int Backlog) : Path(RefFilePath){
+    SocketFd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (SocketFd != FAILED_TO_OPEN) {
+
+        struct sockaddr_un addr;
+        std::memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        std::strncpy(addr.sun_path, Path.c_str(), sizeof(addr.sun_path) - 1);
+
+        // Only a socket file is replaced, never a regular file at a mistyped path
+        struct stat info;
+        if(lstat(Path.c_str(), &info) == 0 && S_ISSOCK(info.st_mode)){
+            unlink(Path.c_str());
+        }
+        if(bind(SocketFd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) != 0 ||
+           listen(SocketFd, Backlog) != 0){
+            close(SocketFd);
+            SocketFd = FAILED_TO_OPEN;
+        }
+    }
+}
+
+bool SafeServerSocket::IsOpen(){
+    return(SocketFd!=FAILED_TO_OPEN);
+}
+
+int SafeServerSocket::Fd() const{
+    return(SocketFd);
+}
+
+int SafeServerSocket::Accept(){
+    if(SocketFd == FAILED_TO_OPEN){
+        return FAILED_TO_OPEN;
+    }
+    int ClientFd;
+    do {
+        ClientFd = accept4(SocketFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    } while (ClientFd == FAILED_TO_OPEN && (errno == EINTR || errno == ECONNABORTED));
+    return ClientFd;
+}
+
+SafeServerSocket::~SafeServerSocket(){
+    if(SocketFd != FAILED_TO_OPEN){
+        close(SocketFd);
+        unlink(Path.c_str());
+    }
+}
@@ -11,8 +11,10 @@ constexpr int FAILED_TO_OPEN = -1;
 constexpr int FAILED_TO_CONNECT = -1;
 
 
-SafeSocket::SafeSocket(std::string &RefFilePath){
-   SocketFd = socket(AF_UNIX, SOCK_STREAM, 0);
+SafeSocket::SafeSocket(std::string &RefFilePath, bool NonBlocking){
+   // Non-blocking: a peer whose backlog is full fails with EAGAIN instead of
+   // holding up the caller
+   SocketFd = socket(AF_UNIX, NonBlocking ? (SOCK_STREAM | SOCK_NONBLOCK) : SOCK_STREAM, 0);
     if (SocketFd != FAILED_TO_OPEN) {
         
         // Setup address structure
@@ -36,23 +38,27 @@ SafeSocket::SafeSocket(std::string &RefFilePath){
 }
 
 bool SafeSocket::IsOpen(){
-    return(SocketFd!=FAILED_TO_OPEN);
+    return(SocketFd!=FAILED_TO_OPEN && !(Reader.atEnd() && Reader.buffered() == 0));
+}
+
+int SafeSocket::Fd() const{
+    return(SocketFd);
 }
 
 std::string SafeSocket::Read(){
-    std::string returnString;
-    if(SocketFd != FAILED_TO_OPEN){
-        char ch;
-    
-        // Read one character at a time until newline or EOF
-        while (read(SocketFd, &ch, 1) == 1) {
-            if (ch == '\n') {
-                break;
-            }
-            returnString += ch;
-        }
+    std::string_view line;
+    if(ReadLine(line)){
+        return std::string(line);
+    }
+    return std::string();
+}
+
+bool SafeSocket::ReadLine(std::string_view &line){
+    if(SocketFd == FAILED_TO_OPEN){
+        return false;
     }
-    return(returnString);
+    // Buffered: one read() brings in every queued line, not one byte
+    return Reader.readLine(SocketFd, line);
 }
 
 SafeSocket::~SafeSocket(){
@@ -5,7 +5,17 @@
 
 
 void ConsoleSinkImpl::write(const LogMessage &log_message){
-    std::cout<< const_cast<LogMessage&>(log_message).ToString() <<std::endl;
+    std::cout<< log_message.Render(Format) <<std::endl;
 }
 
+void ConsoleSinkImpl::writeBatch(const LogMessage *log_messages, size_t count){
+    // Build the whole batch first, then one write + one flush
+    std::string lines;
+    for (size_t i = 0; i < count; ++i) {
+        lines += log_messages[i].Render(Format);
+        lines += '\n';
+    }
+    std::cout.write(lines.data(), static_cast<std::streamsize>(lines.size()));
+    std::cout.flush();
+}
 
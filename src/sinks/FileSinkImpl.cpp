@@ -1,18 +1,133 @@
 #include <string>
-#include <fstream>
 #include <iostream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <cerrno>
 #include "sinks/FileSinkImpl.hpp"
 
-FileSinkImpl::FileSinkImpl(std::string &RefFilePath) : FilePath(RefFilePath){}
+constexpr int FAILED_TO_OPEN = -1;
 
-void FileSinkImpl::write(const LogMessage &log_message) {
-    std::ofstream outFile(FilePath.c_str(), std::ios::app);
+FileSinkImpl::FileSinkImpl(std::string &RefFilePath,
+                           size_t flushBytes,
+                           std::chrono::milliseconds flushInterval,
+                           LogFormat_enum format)
+    : FilePath(RefFilePath)
+    , Format(format)
+    , fd(FAILED_TO_OPEN)
+    , fileDev(0)
+    , fileIno(0)
+    , FlushBytes(flushBytes)
+    , FlushInterval(flushInterval)
+    , lastFlush(std::chrono::steady_clock::now())
+{
+    pending.reserve(FlushBytes);
+    openFile();
+}
 
-    if(outFile.is_open() == true){
-        outFile<<const_cast<LogMessage&> (log_message).ToString()<<std::endl;
-        outFile.close();
-    }else{
+bool FileSinkImpl::openFile() {
+    fd = ::open(FilePath.c_str(), O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0644);
+    if (fd == FAILED_TO_OPEN) {
         std::cerr << "Error: Could not open file for writing : " << FilePath <<  std::endl;
+        return false;
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) == 0) {
+        fileDev = st.st_dev;
+        fileIno = st.st_ino;
+    }
+    return true;
+}
+
+// logrotate & co. rename or delete the file: follow the path, not the old inode
+void FileSinkImpl::reopenIfRotated() {
+    struct stat st;
+    bool rotated = (::stat(FilePath.c_str(), &st) != 0) ||
+                   (st.st_dev != fileDev) || (st.st_ino != fileIno);
+
+    if (fd == FAILED_TO_OPEN || rotated) {
+        if (fd != FAILED_TO_OPEN) {
+            ::close(fd);
+        }
+        openFile();
+    }
+}
+
+bool FileSinkImpl::appendLine(const LogMessage &log_message) {
+    pending += log_message.Render(Format);
+    pending += '\n';
+    return log_message.GetSeverityLevel() == SeverityLvl_enum::CRITICAL;
+}
+
+void FileSinkImpl::flushIfDue() {
+    if (pending.size() >= FlushBytes ||
+        std::chrono::steady_clock::now() - lastFlush >= FlushInterval) {
+        flushPending();
+    }
+}
+
+void FileSinkImpl::flushPending() {
+    lastFlush = std::chrono::steady_clock::now();
+    if (pending.empty()) {
+        return;
+    }
+
+    reopenIfRotated();
+    if (fd == FAILED_TO_OPEN) {
+        pending.clear();    // Nowhere to write: don't grow without bound
+        return;
+    }
+
+    const char* data = pending.data();
+    size_t remaining = pending.size();
+    while (remaining > 0) {
+        ssize_t written = ::write(fd, data, remaining);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            std::cerr << "Error: Could not write to file : " << FilePath <<  std::endl;
+            break;
+        }
+        data += written;
+        remaining -= static_cast<size_t>(written);
+    }
+
+    pending.clear();
+}
+
+// A CRITICAL line is on disk before the sink returns: it is what a crash must not lose
+void FileSinkImpl::write(const LogMessage &log_message) {
+    if (appendLine(log_message)) {
+        flushPending();
+        return;
+    }
+    flushIfDue();
+}
+
+void FileSinkImpl::writeBatch(const LogMessage *log_messages, size_t count) {
+    bool critical = false;
+    for (size_t i = 0; i < count; ++i) {
+        critical |= appendLine(log_messages[i]);
+    }
+    if (critical) {
+        flushPending();
+        return;
+    }
+    flushIfDue();
+}
+
+void FileSinkImpl::flush() {
+    flushPending();
+}
+
+std::chrono::milliseconds FileSinkImpl::flushInterval() const {
+    return FlushInterval;
+}
+
+FileSinkImpl::~FileSinkImpl() {
+    flushPending();
+    if (fd != FAILED_TO_OPEN) {
+        ::close(fd);
     }
 }
 
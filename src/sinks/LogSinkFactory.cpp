@@ -7,11 +7,14 @@
 std::unique_ptr<ILogSink> LogSinkFactory::CreateSink(const SinkConfig& SinkConfigRef) {
     switch(SinkConfigRef.type) {
         case SinkType::CONSOLE: 
-            return std::make_unique<ConsoleSinkImpl>();  
+            return std::make_unique<ConsoleSinkImpl>(SinkConfigRef.format);  
             
         case SinkType::FILE:    
             return std::make_unique<FileSinkImpl>(
-                const_cast<std::string&>(SinkConfigRef.filePath)
+                const_cast<std::string&>(SinkConfigRef.filePath),
+                FileSinkImpl::DefaultFlushBytes,
+                FileSinkImpl::DefaultFlushInterval,
+                SinkConfigRef.format
             );  
             
         default:                
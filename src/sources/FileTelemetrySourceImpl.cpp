@@ -16,8 +16,16 @@ bool FileTelemetrySourceImpl::readSource(std::string &RefRead){
     bool ReturnState;
     if(_safeFilePtr != nullptr){
         if(_safeFilePtr->IsOpen() == true){
-            RefRead = _safeFilePtr->Read();
-            ReturnState = !RefRead.empty();
+            // Lines come from SafeFile's buffer: RefRead keeps its capacity between reads
+            std::string_view line;
+            if(_safeFilePtr->ReadLine(line)){
+                RefRead.assign(line.data(), line.size());
+                ReturnState = true;
+            }else{
+                // No complete line yet (a pipe or FIFO with nothing queued), or end of file
+                RefRead.clear();
+                ReturnState = !_safeFilePtr->AtEnd();
+            }
         }else{
             ReturnState = false;
         }
@@ -27,3 +35,6 @@ bool FileTelemetrySourceImpl::readSource(std::string &RefRead){
     return(ReturnState);
 }
 
+int FileTelemetrySourceImpl::sourceFd() const{
+    return (_safeFilePtr != nullptr) ? _safeFilePtr->Fd() : -1;
+}
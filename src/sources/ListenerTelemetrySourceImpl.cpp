@@ -0,0 +1,157 @@
+#include <algorithm>
+#include <cctype>
+#include <sys/epoll.h>
+#include <unistd.h>
+#include "sources/ListenerTelemetrySourceImpl.hpp"
+
+
+ListenerTelemetrySourceImpl::ListenerTelemetrySourceImpl(std::string &RefFilePath, size_t MaxConnections)
+    : FilePath(RefFilePath), MaxConnections(MaxConnections){
+}
+
+ListenerTelemetrySourceImpl::~ListenerTelemetrySourceImpl(){
+    closeSource();
+}
+
+bool ListenerTelemetrySourceImpl::openSource(){
+    closeSource();
+    _serverPtr.reset(new SafeServerSocket(FilePath));
+    EpollFd = epoll_create1(EPOLL_CLOEXEC);
+    if(!_serverPtr->IsOpen() || EpollFd < 0){
+        closeSource();
+        return false;
+    }
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = _serverPtr->Fd();
+    if(epoll_ctl(EpollFd, EPOLL_CTL_ADD, _serverPtr->Fd(), &event) != 0){
+        closeSource();
+        return false;
+    }
+    return true;
+}
+
+bool ListenerTelemetrySourceImpl::readSource(std::string &RefRead){
+    if(_serverPtr == nullptr){
+        return false;
+    }
+    std::string_view line;
+    for(;;){
+        // Once per round (of at least MinRound lines): a busy producer never
+        // empties Ready, and the others would not be looked at until it did
+        if(UntilPoll == 0 || Ready.empty()){
+            if(!pollReady()){
+                RefRead.clear();
+                return true;
+            }
+            UntilPoll = std::max(Ready.size(), MinRound);
+        }
+        --UntilPoll;
+        Connection* connection = Ready.front();
+        Ready.pop_front();
+
+        if(connection->Reader.readLine(connection->Fd, line)){
+            // Back of the line: the others get a turn before its next line
+            Ready.push_back(connection);
+            if(!line.empty() && line.front() == '@'){
+                connection->Tag.assign(line.substr(1));
+                continue;
+            }
+            if(!connection->Tag.empty() && labelOf(line).empty()){
+                RefRead.assign(connection->Tag).append(": ").append(line);
+            }else{
+                RefRead.assign(line.data(), line.size());
+            }
+            return true;
+        }
+
+        // Nothing more for now (epoll reports it again), or the producer left
+        connection->Queued = false;
+        if(connection->Reader.atEnd()){
+            closeConnection(connection->Fd);
+        }
+    }
+}
+
+int ListenerTelemetrySourceImpl::sourceFd() const{
+    return EpollFd;
+}
+
+void ListenerTelemetrySourceImpl::closeSource(){
+    Ready.clear();
+    UntilPoll = 0;
+    for(auto& item : Connections){
+        close(item.first);
+    }
+    Connections.clear();
+    if(EpollFd >= 0){
+        close(EpollFd);
+        EpollFd = -1;
+    }
+    _serverPtr.reset();
+}
+
+bool ListenerTelemetrySourceImpl::pollReady(){
+    epoll_event events[64];
+    const int count = epoll_wait(EpollFd, events, 64, 0);
+    for(int i = 0; i < count; ++i){
+        const int fd = events[i].data.fd;
+        if(fd == _serverPtr->Fd()){
+            acceptPending();
+            continue;
+        }
+        auto it = Connections.find(fd);
+        if(it != Connections.end() && !it->second.Queued){
+            it->second.Queued = true;
+            Ready.push_back(&it->second);
+        }
+    }
+    return !Ready.empty();
+}
+
+void ListenerTelemetrySourceImpl::acceptPending(){
+    for(int fd = _serverPtr->Accept(); fd >= 0; fd = _serverPtr->Accept()){
+        // Over the limit: closed at once, so the producer sees it instead of waiting in the backlog
+        if(Connections.size() >= MaxConnections){
+            close(fd);
+            ++Rejected;
+            continue;
+        }
+        epoll_event event{};
+        event.events = EPOLLIN | EPOLLRDHUP;
+        event.data.fd = fd;
+        if(epoll_ctl(EpollFd, EPOLL_CTL_ADD, fd, &event) != 0){
+            close(fd);
+            ++Rejected;
+            continue;
+        }
+        Connections.emplace(fd, Connection{fd, LineReader(), std::string(), false});
+        ++Accepted;
+    }
+}
+
+void ListenerTelemetrySourceImpl::closeConnection(int Fd){
+    epoll_ctl(EpollFd, EPOLL_CTL_DEL, Fd, nullptr);
+    close(Fd);
+    Connections.erase(Fd);
+    ++Disconnected;
+}
+
+std::string_view ListenerTelemetrySourceImpl::labelOf(std::string_view line){
+    size_t start = 0;
+    while(start < line.size() && (line[start] == ' ' || line[start] == '\t')){
+        ++start;
+    }
+    if(start == line.size() || !std::isalpha(static_cast<unsigned char>(line[start]))){
+        return std::string_view();
+    }
+    size_t colon = line.find(':', start);
+    if(colon == std::string_view::npos){
+        return std::string_view();
+    }
+    size_t end = colon;
+    while(end > start && (line[end - 1] == ' ' || line[end - 1] == '\t')){
+        --end;
+    }
+    return line.substr(start, end - start);
+}
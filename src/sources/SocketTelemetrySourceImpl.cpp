@@ -9,7 +9,7 @@ SocketTelemetrySourceImpl::SocketTelemetrySourceImpl(std::string &RefFilePath) :
 
 
 bool SocketTelemetrySourceImpl::openSource(){
-    _safeSocketPtr.reset(new SafeSocket(FilePath));
+    _safeSocketPtr.reset(new SafeSocket(FilePath, true));
     return(_safeSocketPtr->IsOpen());
 }
 
@@ -17,8 +17,16 @@ bool SocketTelemetrySourceImpl::readSource(std::string &RefRead){
     bool ReturnState;
     if(_safeSocketPtr != nullptr){
         if(_safeSocketPtr->IsOpen() == true){
-            RefRead = _safeSocketPtr->Read();
-            ReturnState = true;
+            // Lines come from SafeSocket's buffer: RefRead keeps its capacity between reads
+            std::string_view line;
+            if(_safeSocketPtr->ReadLine(line)){
+                RefRead.assign(line.data(), line.size());
+                ReturnState = true;
+            }else{
+                // No complete line yet (EAGAIN), or the peer is gone
+                RefRead.clear();
+                ReturnState = _safeSocketPtr->IsOpen();
+            }
         }else{
             ReturnState = false;
         }
@@ -28,5 +36,10 @@ bool SocketTelemetrySourceImpl::readSource(std::string &RefRead){
     return(ReturnState);
 }
 
+int SocketTelemetrySourceImpl::sourceFd() const{
+    return (_safeSocketPtr != nullptr) ? _safeSocketPtr->Fd() : -1;
+}
 
-
+void SocketTelemetrySourceImpl::closeSource(){
+    _safeSocketPtr.reset();
+}
@@ -0,0 +1,202 @@
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#include "utils/Reactor.hpp"
+
+
+Reactor::Reactor()
+    : epollFd(epoll_create1(EPOLL_CLOEXEC))
+    , wakeFd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {
+    if (epollFd < 0 || wakeFd < 0) {
+        std::cerr << "Error: Reactor setup failed: " << std::strerror(errno) << std::endl;
+        return;
+    }
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = wakeFd;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &event);
+}
+
+Reactor::~Reactor() {
+    for (const auto& item : entries) {
+        if (item.second->timer) {
+            close(item.first);
+        }
+    }
+    if (wakeFd >= 0) {
+        close(wakeFd);
+    }
+    if (epollFd >= 0) {
+        close(epollFd);
+    }
+}
+
+bool Reactor::watch(int fd, uint32_t events, Handler handler) {
+    if (!isValid() || fd < 0) {
+        return false;
+    }
+    epoll_event event{};
+    event.events = events;
+    event.data.fd = fd;
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) != 0) {
+        return false;
+    }
+    // A handler must never block the loop on a read
+    const int flags = fcntl(fd, F_GETFL);
+    if (flags >= 0) {
+        fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+    }
+    entries[fd] = std::make_shared<Entry>(Entry{std::move(handler), false});
+    return true;
+}
+
+void Reactor::unwatch(int fd) {
+    remove(fd);
+}
+
+Reactor::TimerId Reactor::addTimer(std::chrono::milliseconds period, Handler handler) {
+    if (period.count() <= 0) {
+        return -1;
+    }
+    const TimerId id = addTimer(std::move(handler));
+    if (id >= 0 && !arm(id, period, period)) {
+        removeTimer(id);
+        return -1;
+    }
+    return id;
+}
+
+Reactor::TimerId Reactor::addTimer(Handler handler) {
+    if (!isValid()) {
+        return -1;
+    }
+    const int fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (fd < 0) {
+        std::cerr << "Error: timerfd_create failed: " << std::strerror(errno) << std::endl;
+        return -1;
+    }
+
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = fd;
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) != 0) {
+        std::cerr << "Error: Reactor timer setup failed: " << std::strerror(errno) << std::endl;
+        close(fd);
+        return -1;
+    }
+    entries[fd] = std::make_shared<Entry>(Entry{std::move(handler), true});
+    return fd;
+}
+
+bool Reactor::arm(TimerId id, std::chrono::milliseconds delay, std::chrono::milliseconds period) {
+    auto it = entries.find(id);
+    if (it == entries.end() || !it->second->timer) {
+        return false;
+    }
+    itimerspec spec{};
+    spec.it_interval.tv_sec = static_cast<time_t>(period.count() / 1000);
+    spec.it_interval.tv_nsec = static_cast<long>((period.count() % 1000) * 1000000);
+    spec.it_value.tv_sec = static_cast<time_t>(delay.count() / 1000);
+    spec.it_value.tv_nsec = static_cast<long>((delay.count() % 1000) * 1000000);
+    if (delay.count() <= 0) {
+        // A zero it_value would disarm it
+        spec.it_value.tv_sec = 0;
+        spec.it_value.tv_nsec = 1;
+    }
+    if (timerfd_settime(id, 0, &spec, nullptr) != 0) {
+        std::cerr << "Error: timerfd_settime failed: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void Reactor::removeTimer(TimerId id) {
+    remove(id);
+}
+
+void Reactor::remove(int fd) {
+    auto it = entries.find(fd);
+    if (it == entries.end()) {
+        return;
+    }
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+    if (it->second->timer) {
+        close(fd);
+    }
+    entries.erase(it);
+}
+
+void Reactor::defer(std::function<void()> fn) {
+    deferred.push_back(std::move(fn));
+}
+
+void Reactor::run() {
+    std::vector<std::function<void()>> batch;
+    while (isValid() && !stopRequested.load(std::memory_order_acquire)) {
+        // Deferred work pending: only look for events, do not sleep
+        runOnce(deferred.empty() ? -1 : 0);
+
+        batch.swap(deferred);
+        for (auto& fn : batch) {
+            fn();
+        }
+        batch.clear();
+    }
+    deferred.clear();
+    stopRequested.store(false, std::memory_order_release);
+}
+
+size_t Reactor::runOnce(int timeoutMs) {
+    epoll_event events[MaxEvents];
+    const int ready = epoll_wait(epollFd, events, MaxEvents, timeoutMs);
+    if (ready < 0) {
+        if (errno != EINTR) {
+            std::cerr << "Error: epoll_wait failed: " << std::strerror(errno) << std::endl;
+        }
+        return 0;
+    }
+
+    size_t called = 0;
+    for (int i = 0; i < ready; ++i) {
+        const int fd = events[i].data.fd;
+        if (fd == wakeFd) {
+            uint64_t count;
+            while (read(wakeFd, &count, sizeof(count)) > 0) {}
+            continue;
+        }
+
+        // Looked up per event: an earlier handler may have removed this one.
+        // The copy keeps the handler alive if it removes itself.
+        auto it = entries.find(fd);
+        if (it == entries.end()) {
+            continue;
+        }
+        std::shared_ptr<Entry> entry = it->second;
+
+        uint32_t argument = events[i].events;
+        if (entry->timer) {
+            uint64_t expirations = 0;
+            if (read(fd, &expirations, sizeof(expirations)) != sizeof(expirations)) {
+                continue;
+            }
+            argument = static_cast<uint32_t>(expirations);
+        }
+        entry->handler(argument);
+        ++called;
+    }
+    return called;
+}
+
+void Reactor::stop() {
+    stopRequested.store(true, std::memory_order_release);
+    const uint64_t one = 1;
+    if (wakeFd >= 0) {
+        ssize_t written = write(wakeFd, &one, sizeof(one));
+        (void)written;
+    }
+}
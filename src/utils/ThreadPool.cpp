@@ -1,49 +1,275 @@
+#include "utils/ThreadPool.hpp"
 
 
-
-#include "utils/ThreadPool.hpp"
+namespace {
+    // Set on pool worker threads so submit() can find the caller's own deque
+    thread_local const ThreadPool* currentPool = nullptr;
+    thread_local size_t currentIndex = 0;
+}
 
 
-ThreadPool::ThreadPool(size_t threads) : stop(false) {
+ThreadPool::ThreadPool(size_t threads)
+    : injectedCount(0), sleepers(0), stop(false), freeNodes(NodeCacheSize) {
+    // Create every deque before any worker starts stealing from them
     for (size_t i = 0; i < threads; ++i) {
-        workers.emplace_back([this] {
-            std::unique_lock<std::mutex> lock(this->mx,std::defer_lock);
-            std::function<void()> task;
-            while (true) {
-
-                lock.lock();
-                // block until: task pushed into the queue OR stopping
-                this->cv.wait(lock, [this] { 
-                    return this->stop.load() || !this->tasks.empty(); 
-                });
-                if (this->stop.load() && this->tasks.empty()){return;}
-
-                task = std::move(this->tasks.front());
-                this->tasks.pop();
-
-                lock.unlock();
-                task();
-            }
-        });
+        workers.push_back(std::make_unique<Worker>());
+    }
+    for (size_t i = 0; i < threads; ++i) {
+        workers[i]->thread = std::thread([this, i] { workerLoop(i); });
+    }
+}
+
+void ThreadPool::workerLoop(size_t index) {
+    currentPool = this;
+    currentIndex = index;
+
+    while (true) {
+        TaskNode* task = findTask(index);
+
+        // Spin a little before parking: new work usually arrives in bursts
+        for (size_t spin = 0; task == nullptr && spin < SpinRounds; ++spin) {
+            std::this_thread::yield();
+            task = findTask(index);
+        }
+
+        if (task == nullptr) {
+            std::unique_lock<std::mutex> lock(mx);
+            sleepers.fetch_add(1, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            // block until: task queued anywhere OR stopping
+            cv.wait(lock, [this] {
+                return stop.load() || hasQueuedTasks();
+            });
+            sleepers.fetch_sub(1, std::memory_order_relaxed);
+            if (stop.load() && !hasQueuedTasks()) {return;}
+            continue;
+        }
+
+        runNode(task);
     }
 }
 
-void ThreadPool::submit(std::function<void()> task) {
+ThreadPool::TaskNode* ThreadPool::findTask(size_t index) {
+    TaskNode* task = nullptr;
+
+    // 1. Own deque, newest first (still hot in cache)
+    if (workers[index]->deque.pop(task)) {
+        return task;
+    }
+
+    // 2. Work submitted from outside the pool
+    task = popInjected();
+    if (task != nullptr) {
+        return task;
+    }
+
+    // 3. Steal the oldest task of another worker
+    const size_t count = workers.size();
+    for (size_t i = 1; i < count; ++i) {
+        if (workers[(index + i) % count]->deque.steal(task)) {
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+ThreadPool::TaskNode* ThreadPool::popInjected() {
+    if (injectedCount.load(std::memory_order_acquire) == 0) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(injectMx);
+    TaskNode* node = injected.pop();
+    if (node != nullptr) {
+        injectedCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+    return node;
+}
+
+bool ThreadPool::hasQueuedTasks() const {
+    if (injectedCount.load(std::memory_order_acquire) != 0) {
+        return true;
+    }
+    for (const auto& worker : workers) {
+        if (!worker->deque.empty()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::inject(TaskNode* node) {
+    {
+        std::lock_guard<std::mutex> lock(injectMx);
+        injected.push(node);
+    }
+    injectedCount.fetch_add(1, std::memory_order_release);
+}
+
+void ThreadPool::wakeOne() {
+    // Pairs with the fence in workerLoop: either a parking worker sees the
+    // new task in its predicate, or we see it in 'sleepers' and notify
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleepers.load(std::memory_order_relaxed) == 0) {
+        return;
+    }
     {
         std::lock_guard<std::mutex> lock(mx);
-        // push task into the queue
-        tasks.emplace(std::move(task));
     }
     cv.notify_one();
 }
 
+ThreadPool::TaskNode* ThreadPool::acquireNode() {
+    std::optional<TaskNode*> cached = freeNodes.try_pop();
+    if (cached.has_value()) {
+        return *cached;
+    }
+    return new TaskNode();
+}
+
+void ThreadPool::releaseNode(TaskNode* node) {
+    if (node->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;     // A Completion still refers to it
+    }
+    node->done.store(false, std::memory_order_relaxed);
+    if (!freeNodes.try_push(node)) {
+        delete node;
+    }
+}
+
+void ThreadPool::runNode(TaskNode* node) {
+    node->task();
+    // Drop the captures now, not when the node is reused
+    node->task.reset();
+
+    const bool tracked = node->refs.load(std::memory_order_acquire) > 1;
+    node->done.store(true, std::memory_order_release);
+    if (tracked) {
+        {
+            std::lock_guard<std::mutex> lock(completionMx);
+        }
+        completionCv.notify_all();
+    }
+    releaseNode(node);
+}
+
+void ThreadPool::schedule(TaskNode* node) {
+    if (currentPool == this) {
+        workers[currentIndex]->deque.push(node);
+    } else {
+        inject(node);
+    }
+    wakeOne();
+}
+
+void ThreadPool::schedulePosted(TaskNode* node) {
+    inject(node);
+    wakeOne();
+}
+
 ThreadPool::~ThreadPool() {
-    stop = true;
+    {
+        std::lock_guard<std::mutex> lock(mx);
+        stop = true;
+    }
     cv.notify_all();
-    for (std::thread &worker : workers) {
-        if (worker.joinable()) {
-            worker.join();
+    for (auto& worker : workers) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+
+    while (std::optional<TaskNode*> cached = freeNodes.try_pop()) {
+        delete *cached;
+    }
+}
+
+
+
+// ============================================
+// Completion
+// ============================================
+Completion& Completion::operator=(Completion&& other) noexcept {
+    if (this != &other) {
+        release();
+        pool = other.pool;
+        node = other.node;
+        other.node = nullptr;
+    }
+    return *this;
+}
+
+void Completion::release() {
+    if (node != nullptr) {
+        pool->releaseNode(node);
+        node = nullptr;
+    }
+}
+
+bool Completion::ready() const {
+    return node == nullptr || node->done.load(std::memory_order_acquire);
+}
+
+void Completion::wait() const {
+    if (node == nullptr) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(pool->completionMx);
+    pool->completionCv.wait(lock, [this] { return node->done.load(std::memory_order_acquire); });
+}
+
+bool Completion::wait_for(std::chrono::milliseconds timeout) const {
+    if (node == nullptr) {
+        return true;
+    }
+    std::unique_lock<std::mutex> lock(pool->completionMx);
+    return pool->completionCv.wait_for(lock, timeout, [this] {
+        return node->done.load(std::memory_order_acquire);
+    });
+}
+
+
+
+// ============================================
+// Strand
+// ============================================
+Strand::Strand(ThreadPool& pool) : pool(pool), scheduled(false) {}
+
+Strand::~Strand() {
+    // The worker that ran our last task may still be inside drain(),
+    // about to lock 'mx' again: wait until it has let go of the strand
+    std::unique_lock<std::mutex> lock(mx);
+    idle.wait(lock, [this] { return !scheduled; });
+}
+
+void Strand::enqueue(threadpool_detail::TaskNode* node) {
+    bool needsDrain = false;
+    {
+        std::lock_guard<std::mutex> lock(mx);
+        tasks.push(node);
+        if (!scheduled) {
+            scheduled = true;
+            needsDrain = true;
         }
     }
+    if (needsDrain) {
+        pool.submit([this] { drain(); });
+    }
 }
 
+void Strand::drain() {
+    for (size_t ran = 0; ran < MaxTasksPerDrain; ++ran) {
+        threadpool_detail::TaskNode* node;
+        {
+            std::lock_guard<std::mutex> lock(mx);
+            node = tasks.pop();
+            if (node == nullptr) {
+                scheduled = false;
+                idle.notify_all();
+                return;
+            }
+        }
+        pool.runNode(node);
+    }
+    // Still work left: yield the worker to other strands, queue behind them
+    pool.post([this] { drain(); });
+}
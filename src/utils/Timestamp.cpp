@@ -0,0 +1,185 @@
+#include <charconv>
+#include <climits>
+#include <cstring>
+#include <ctime>
+#include "utils/Timestamp.hpp"
+
+
+namespace {
+    constexpr int64_t NanosPerSecond = 1000000000;
+    constexpr size_t PrefixLength = 19;     // "YYYY-MM-DD HH:MM:SS"
+
+    // Last second this thread formatted; only a new second calls localtime_r
+    struct SecondCache {
+        int64_t second = INT64_MIN;
+        char prefix[PrefixLength];
+    };
+    thread_local SecondCache secondCache;
+
+    // to_chars does not pad: right-align 'value' in 'width' zero-filled chars
+    void writePadded(char* out, unsigned value, size_t width) {
+        char digits[16];
+        const size_t count = static_cast<size_t>(std::to_chars(digits, digits + sizeof(digits), value).ptr - digits);
+        if (count >= width) {
+            std::memcpy(out, digits + (count - width), width);
+            return;
+        }
+        std::memset(out, '0', width - count);
+        std::memcpy(out + (width - count), digits, count);
+    }
+
+    // Last local hour this thread parsed, with its UTC offset
+    struct OffsetCache {
+        int64_t localHour = INT64_MIN;
+        int64_t offset = 0;
+    };
+    thread_local OffsetCache offsetCache;
+
+    int64_t utcOffsetAt(int64_t second) {
+        std::time_t time = static_cast<std::time_t>(second);
+        std::tm local{};
+        localtime_r(&time, &local);
+        return static_cast<int64_t>(local.tm_gmtoff);
+    }
+
+    // Days since 1970-01-01 of a proleptic Gregorian date
+    int64_t daysFromCivil(int64_t year, unsigned month, unsigned day) {
+        year -= month <= 2;
+        const int64_t era = (year >= 0 ? year : year - 399) / 400;
+        const unsigned yearOfEra = static_cast<unsigned>(year - era * 400);
+        const unsigned dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+        const unsigned dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+        return era * 146097 + static_cast<int64_t>(dayOfEra) - 719468;
+    }
+
+    bool readNumber(std::string_view text, size_t pos, size_t count, unsigned& value) {
+        value = 0;
+        for (size_t i = pos; i < pos + count; ++i) {
+            if (text[i] < '0' || text[i] > '9') {
+                return false;
+            }
+            value = value * 10 + static_cast<unsigned>(text[i] - '0');
+        }
+        return true;
+    }
+
+    const char* prefixFor(int64_t second) {
+        if (secondCache.second != second) {
+            std::time_t time = static_cast<std::time_t>(second);
+            std::tm local{};
+            localtime_r(&time, &local);
+
+            char* p = secondCache.prefix;
+            writePadded(p,      static_cast<unsigned>(local.tm_year + 1900), 4);
+            p[4] = '-';
+            writePadded(p + 5,  static_cast<unsigned>(local.tm_mon + 1), 2);
+            p[7] = '-';
+            writePadded(p + 8,  static_cast<unsigned>(local.tm_mday), 2);
+            p[10] = ' ';
+            writePadded(p + 11, static_cast<unsigned>(local.tm_hour), 2);
+            p[13] = ':';
+            writePadded(p + 14, static_cast<unsigned>(local.tm_min), 2);
+            p[16] = ':';
+            writePadded(p + 17, static_cast<unsigned>(local.tm_sec), 2);
+            secondCache.second = second;
+        }
+        return secondCache.prefix;
+    }
+}
+
+
+std::atomic<int64_t> Timestamp::coarseNs{0};
+std::atomic<int> Timestamp::tickers{0};
+
+int64_t Timestamp::nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+int64_t Timestamp::coarseNowNs() {
+    const int64_t coarse = coarseNs.load(std::memory_order_relaxed);
+    return (coarse != 0) ? coarse : nowNs();
+}
+
+size_t Timestamp::format(int64_t timestampNs, char* out, Precision precision) {
+    // Floor division: timestamps before 1970 still land on the right second
+    int64_t second = timestampNs / NanosPerSecond;
+    int64_t fraction = timestampNs % NanosPerSecond;
+    if (fraction < 0) {
+        --second;
+        fraction += NanosPerSecond;
+    }
+
+    std::memcpy(out, prefixFor(second), PrefixLength);
+
+    switch (precision) {
+        case Precision::Millis:
+            out[PrefixLength] = '.';
+            writePadded(out + PrefixLength + 1, static_cast<unsigned>(fraction / 1000000), 3);
+            return PrefixLength + 4;
+        case Precision::Micros:
+            out[PrefixLength] = '.';
+            writePadded(out + PrefixLength + 1, static_cast<unsigned>(fraction / 1000), 6);
+            return PrefixLength + 7;
+        case Precision::Seconds:
+        default:
+            return PrefixLength;
+    }
+}
+
+std::string Timestamp::format(int64_t timestampNs, Precision precision) {
+    char buffer[MaxLength];
+    return std::string(buffer, format(timestampNs, buffer, precision));
+}
+
+bool Timestamp::parse(std::string_view text, int64_t& timestampNs) {
+    unsigned year, month, day, hour, minute, second;
+    if (text.size() != PrefixLength ||
+        text[4] != '-' || text[7] != '-' || text[10] != ' ' || text[13] != ':' || text[16] != ':' ||
+        !readNumber(text, 0, 4, year) || !readNumber(text, 5, 2, month) || !readNumber(text, 8, 2, day) ||
+        !readNumber(text, 11, 2, hour) || !readNumber(text, 14, 2, minute) || !readNumber(text, 17, 2, second) ||
+        month < 1 || month > 12 || day < 1 || day > 31 || hour > 23 || minute > 59 || second > 60) {
+        return false;
+    }
+
+    const int64_t local = daysFromCivil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second;
+    if (offsetCache.localHour != local / 3600) {
+        // The offset in force at local - offset; a second look settles DST changes
+        int64_t offset = utcOffsetAt(local);
+        offset = utcOffsetAt(local - offset);
+        offsetCache.localHour = local / 3600;
+        offsetCache.offset = offset;
+    }
+    timestampNs = (local - offsetCache.offset) * NanosPerSecond;
+    return true;
+}
+
+
+
+// ============================================
+// Ticker
+// ============================================
+Timestamp::Ticker::Ticker(std::chrono::microseconds period)
+    : period(period), stop(false) {
+    // Valid before the first tick
+    coarseNs.store(nowNs(), std::memory_order_relaxed);
+    tickers.fetch_add(1, std::memory_order_relaxed);
+    thread = std::thread([this] { run(); });
+}
+
+void Timestamp::Ticker::run() {
+    while (!stop.load(std::memory_order_relaxed)) {
+        std::this_thread::sleep_for(period);
+        coarseNs.store(nowNs(), std::memory_order_relaxed);
+    }
+}
+
+Timestamp::Ticker::~Ticker() {
+    stop.store(true, std::memory_order_relaxed);
+    if (thread.joinable()) {
+        thread.join();
+    }
+    if (tickers.fetch_sub(1, std::memory_order_relaxed) == 1) {
+        coarseNs.store(0, std::memory_order_relaxed);
+    }
+}
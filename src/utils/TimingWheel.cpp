@@ -0,0 +1,212 @@
+#include <algorithm>
+#include "utils/TimingWheel.hpp"
+
+
+namespace {
+
+constexpr uint64_t SlotMask = TimingWheel::Slots - 1;
+
+uint64_t rotateRight(uint64_t bits, unsigned count) {
+    count &= 63;
+    return count == 0 ? bits : (bits >> count) | (bits << (64 - count));
+}
+
+}
+
+TimingWheel::TimingWheel(std::chrono::milliseconds tick, Clock::time_point origin)
+    : tickLength(std::max(tick, std::chrono::milliseconds(1)))
+    , origin(origin) {
+    heads.fill(None);
+}
+
+void TimingWheel::reserve(size_t timers) {
+    dueTick.reserve(timers);
+    periodTicks.reserve(timers);
+    links.reserve(timers);
+    slotOf.reserve(timers);
+    tags.reserve(timers);
+}
+
+TimingWheel::Id TimingWheel::add(Clock::time_point now, std::chrono::milliseconds period, uint32_t tag) {
+    // Golden-ratio sequence: consecutive Ids land evenly across the period
+    const Id id = (freeList != None) ? freeList : static_cast<Id>(dueTick.size());
+    const uint64_t ticks = static_cast<uint64_t>(std::max<int64_t>(period / tickLength, 1));
+    const uint64_t phase = (static_cast<uint64_t>(id * 0x9E3779B9u) * ticks) >> 32;
+    return add(now, period, tickLength * static_cast<int64_t>(phase + 1), tag);
+}
+
+TimingWheel::Id TimingWheel::add(Clock::time_point now, std::chrono::milliseconds period,
+                                 std::chrono::milliseconds phase, uint32_t tag) {
+    Id id;
+    if (freeList != None) {
+        id = freeList;
+        freeList = links[id].next;
+    } else {
+        id = static_cast<Id>(dueTick.size());
+        dueTick.push_back(0);
+        periodTicks.push_back(0);
+        links.push_back({None, None});
+        slotOf.push_back(Free);
+        tags.push_back(0);
+    }
+
+    // Rounded up, so a timer never fires early
+    const auto ticksOf = [this](std::chrono::milliseconds length) {
+        return static_cast<uint64_t>(std::max<int64_t>((length + tickLength - std::chrono::milliseconds(1)) / tickLength, 0));
+    };
+    // From now, not from the last tick processed: after an idle stretch
+    // 'current' lags behind, and the timer would be overdue at once
+    periodTicks[id] = static_cast<uint32_t>(ticksOf(period));
+    dueTick[id] = std::max(current, ticksAt(now)) + std::max<uint64_t>(ticksOf(phase), 1);
+    tags[id] = tag;
+    place(id, current);
+    ++active;
+    return id;
+}
+
+void TimingWheel::remove(Id id) {
+    if (id >= slotOf.size() || slotOf[id] == Free) {
+        return;
+    }
+    if (slotOf[id] != Firing) {
+        unlink(id);
+    }
+    release(id);
+}
+
+std::chrono::milliseconds TimingWheel::untilNext(Clock::time_point now) const {
+    const uint64_t tick = nextEventTick();
+    if (active == 0 || tick == UINT64_MAX) {
+        return std::chrono::milliseconds(-1);
+    }
+    const Clock::time_point due = origin + tickLength * static_cast<int64_t>(tick);
+    if (due <= now) {
+        return std::chrono::milliseconds(0);
+    }
+    return std::chrono::ceil<std::chrono::milliseconds>(due - now);
+}
+
+uint64_t TimingWheel::ticksAt(Clock::time_point time) const {
+    if (time <= origin) {
+        return 0;
+    }
+    return static_cast<uint64_t>((time - origin) / tickLength);
+}
+
+uint64_t TimingWheel::nextEventTick() const {
+    // Per level: the first occupied slot after the current one (the current
+    // one itself counts as a full turn away), turned into the tick it is visited
+    uint64_t earliest = UINT64_MAX;
+    for (unsigned level = 0; level < Levels; ++level) {
+        if (occupied[level] == 0) {
+            continue;
+        }
+        const unsigned shift = SlotBits * level;
+        const uint64_t position = current >> shift;
+        const uint64_t rotated = rotateRight(occupied[level], static_cast<unsigned>((position + 1) & SlotMask));
+        const uint64_t distance = static_cast<uint64_t>(__builtin_ctzll(rotated)) + 1;
+        earliest = std::min(earliest, (position + distance) << shift);
+    }
+    return earliest;
+}
+
+bool TimingWheel::step(uint64_t target) {
+    if (current >= target) {
+        return false;
+    }
+    current = std::min(nextEventTick(), target);
+
+    // On a level boundary its slot moves down, top level first so that
+    // timers can fall through several levels in one tick
+    for (unsigned level = Levels - 1; level > 0; --level) {
+        const unsigned shift = SlotBits * level;
+        if ((current & ((uint64_t{1} << shift) - 1)) != 0) {
+            continue;
+        }
+        const unsigned slot = level * Slots + static_cast<unsigned>((current >> shift) & SlotMask);
+        while (heads[slot] != None) {
+            const Id id = heads[slot];
+            unlink(id);
+            place(id, current);
+        }
+    }
+    return true;
+}
+
+TimingWheel::Id TimingWheel::popDue() {
+    const Id id = heads[current & SlotMask];
+    if (id != None) {
+        unlink(id);
+        slotOf[id] = Firing;
+    }
+    return id;
+}
+
+void TimingWheel::rearm(Id id, uint64_t target) {
+    // onExpire may have removed it (Free), or removed it and reused the Id
+    if (slotOf[id] != Firing) {
+        return;
+    }
+    if (periodTicks[id] == 0) {
+        release(id);
+        return;
+    }
+    // Next due tick after target on the same phase: periods missed while
+    // advance() was late are skipped rather than fired back to back
+    const uint64_t period = periodTicks[id];
+    dueTick[id] += period;
+    if (dueTick[id] <= target) {
+        dueTick[id] += ((target - dueTick[id]) / period + 1) * period;
+    }
+    place(id, current);
+}
+
+void TimingWheel::place(Id id, uint64_t base) {
+    // Level with the smallest span that still reaches the due tick; past the
+    // top level's span, park at its far end and re-place on the way down
+    const uint64_t delta = dueTick[id] - base;
+    uint64_t tick = dueTick[id];
+    unsigned level = 0;
+    while (level < Levels - 1 && delta >= (uint64_t{1} << (SlotBits * (level + 1)))) {
+        ++level;
+    }
+    const uint64_t span = uint64_t{1} << (SlotBits * Levels);
+    if (delta >= span) {
+        tick = base + span - 1;
+    }
+    link(id, level * Slots + static_cast<unsigned>((tick >> (SlotBits * level)) & SlotMask));
+}
+
+void TimingWheel::link(Id id, unsigned slot) {
+    const Id head = heads[slot];
+    links[id] = {head, None};
+    if (head != None) {
+        links[head].prev = id;
+    }
+    heads[slot] = id;
+    slotOf[id] = static_cast<uint16_t>(slot);
+    occupied[slot / Slots] |= uint64_t{1} << (slot % Slots);
+}
+
+void TimingWheel::unlink(Id id) {
+    const unsigned slot = slotOf[id];
+    const Links link = links[id];
+    if (link.prev != None) {
+        links[link.prev].next = link.next;
+    } else {
+        heads[slot] = link.next;
+    }
+    if (link.next != None) {
+        links[link.next].prev = link.prev;
+    }
+    if (heads[slot] == None) {
+        occupied[slot / Slots] &= ~(uint64_t{1} << (slot % Slots));
+    }
+}
+
+void TimingWheel::release(Id id) {
+    slotOf[id] = Free;
+    links[id].next = freeList;
+    freeList = id;
+    --active;
+}